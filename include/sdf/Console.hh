@@ -21,6 +21,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <sdf/sdf_config.h>
@@ -173,6 +174,9 @@ namespace sdf
 
     /// \brief logfile stream
     public: std::ofstream logFileStream;
+
+    /// \brief Mutex to write to the logfile stream from several threads
+    public: std::mutex logFileMutex;
   };
 
   ///////////////////////////////////////////////
@@ -184,10 +188,12 @@ namespace sdf
       *this->stream << _rhs;
     }
 
-    if (Console::Instance()->dataPtr->logFileStream.is_open())
+    const ConsolePtr console = Console::Instance();
+    if (console->dataPtr->logFileStream.is_open())
     {
-      Console::Instance()->dataPtr->logFileStream << _rhs;
-      Console::Instance()->dataPtr->logFileStream.flush();
+      std::lock_guard<std::mutex> lock(console->dataPtr->logFileMutex);
+      console->dataPtr->logFileStream << _rhs;
+      console->dataPtr->logFileStream.flush();
     }
 
     return *this;
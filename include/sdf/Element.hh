@@ -18,14 +18,17 @@
 #define SDF_ELEMENT_HH_
 
 #include <any>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "sdf/Error.hh"
+#include "sdf/InternedString.hh"
 #include "sdf/Param.hh"
 #include "sdf/PrintConfig.hh"
 #include "sdf/sdf_config.h"
@@ -80,11 +83,13 @@ namespace sdf
     /// \brief Destructor.
     public: virtual ~Element();
 
-    /// \brief Create a copy of this Element.
+    /// \brief Create a copy of this Element. Element descriptions are
+    /// shared with the copy rather than duplicated.
     /// \return A copy of this Element.
     public: ElementPtr Clone() const;
 
-    /// \brief Create a copy of this Element.
+    /// \brief Create a copy of this Element. Element descriptions are
+    /// shared with the copy rather than duplicated.
     /// \param[out] _errors Vector of errors.
     /// \return A copy of this Element, NULL if there was an error.
     public: ElementPtr Clone(sdf::Errors &_errors) const;
@@ -376,14 +381,21 @@ namespace sdf
     public: size_t GetElementDescriptionCount() const;
 
     /// \brief Get an element description using an index
+    /// \remarks Element descriptions are shared by every Element created from
+    /// the same schema, so they are read-only. Clone the description to get
+    /// a modifiable Element.
     /// \param[in] _index the index of the element description to get.
     /// \return An Element pointer to the found element.
-    public: ElementPtr GetElementDescription(unsigned int _index) const;
+    public: ElementConstPtr GetElementDescription(unsigned int _index) const;
 
     /// \brief Get an element description using a key
+    /// \remarks Element descriptions are shared by every Element created from
+    /// the same schema, so they are read-only. Clone the description to get
+    /// a modifiable Element.
     /// \param[in] _key the key to use to find the element.
     /// \return An Element pointer to the found element.
-    public: ElementPtr GetElementDescription(const std::string &_key) const;
+    public: ElementConstPtr GetElementDescription(
+                const std::string &_key) const;
 
     /// \brief Return true if an element description exists.
     /// \param[in] _name the name of the element to find.
@@ -508,6 +520,14 @@ namespace sdf
     /// \return True if the named element was found, false otherwise.
     public: bool HasElement(const std::string &_name) const;
 
+    /// \brief Get the number of child elements with a name. Elements with
+    /// many children answer from their child name index in constant time.
+    /// Elements with few children, which have no index, count them in a
+    /// single pass.
+    /// \param[in] _name the name of the elements to count.
+    /// \return Number of child elements named _name.
+    public: size_t GetElementCount(const std::string &_name) const;
+
     /// \brief Get the first child element.
     /// \return A smart pointer to the first child of this element, or
     ///          sdf::ElementPtr(nullptr) if there are no children.
@@ -517,7 +537,9 @@ namespace sdf
     /// \param[in] _name if given then filter siblings by their xml tag.
     /// \remarks This function does not alter or store any state
     ///          Repeated calls to "GetNextElement()" with the same string will
-    ///          always return a pointer to the same element.
+    ///          always return a pointer to the same element. Finding the
+    ///          next sibling with the same name as this element, or with no
+    ///          name filter, takes constant time.
     /// \return A pointer to the next element if it exists,
     ///         sdf::ElementPtr(nullptr) otherwise.
     ///
@@ -731,8 +753,8 @@ namespace sdf
     /// \param[out] _errors Vector of errors.
     public: void Update(sdf::Errors &_errors);
 
-    /// \brief Call reset on each element and element description
-    ///        before deleting all of them.  Also clear out the
+    /// \brief Call reset on each element before deleting all elements
+    ///        and element descriptions.  Also clear out the
     ///        embedded Param.
     public: void Reset();
 
@@ -860,8 +882,26 @@ namespace sdf
                                   sdf::Errors &_errors,
                                   const std::string &_description = "");
 
+    /// \brief Read the value of a key into _value. A value of type T is
+    /// copied straight from its param, other types are converted by
+    /// Param::Get.
+    /// \param[out] _errors Vector of errors.
+    /// \param[in] _key The name of a child attribute or element, or empty
+    /// for the value of this element.
+    /// \param[in,out] _value The value of the key. Left unchanged if the key
+    /// is not found.
+    /// \return True when the _key was found and false otherwise.
+    private: template<typename T>
+             bool GetImpl(sdf::Errors &_errors,
+                          const std::string &_key,
+                          T &_value) const;
+
     /// \brief Private data pointer
     private: std::unique_ptr<ElementPrivate> dataPtr;
+
+    /// \brief ElementPrivate keeps the sibling positions of child elements
+    /// up to date.
+    friend class ElementPrivate;
   };
 
   /// \internal
@@ -869,13 +909,13 @@ namespace sdf
   class ElementPrivate
   {
     /// \brief Element name
-    public: std::string name;
+    public: InternedString name;
 
     /// \brief True if element is required
-    public: std::string required;
+    public: InternedString required;
 
     /// \brief Element description
-    public: std::string description;
+    public: InternedString description;
 
     /// \brief True if element's children should be copied.
     public: bool copyChildren;
@@ -883,6 +923,15 @@ namespace sdf
     /// \brief Element's parent
     public: ElementWeakPtr parent;
 
+    /// \brief Position of this element in the `elements` of the element it
+    /// was last inserted into. GetNextElement uses it as a hint to find this
+    /// element among its siblings in constant time.
+    public: std::size_t siblingIndex;
+
+    /// \brief Position of this element among the children with the same name
+    /// in the `elementIndex` of the element it was last inserted into.
+    public: std::size_t namedSiblingIndex;
+
     // Attributes of this element
     public: Param_V attributes;
 
@@ -892,9 +941,29 @@ namespace sdf
     // The existing child elements
     public: ElementPtr_V elements;
 
-    // The possible child elements
+    /// \brief Index of the existing child elements by name. Each entry
+    /// holds the children with that name in the order they appear in
+    /// `elements`. It is only built once the element has
+    /// kElementIndexThreshold children, and is null until then, since
+    /// scanning a few children is cheaper than a hash table per element.
+    /// Use AppendElement, EraseElement, RenameElement and ClearElements to
+    /// keep it in sync with `elements`.
+    public: std::unique_ptr<std::unordered_map<std::string, ElementPtr_V>>
+        elementIndex;
+
+    /// \brief Number of child elements from which they are indexed by name.
+    public: static constexpr std::size_t kElementIndexThreshold = 8;
+
+    // The possible child elements. These are shared by all elements created
+    // from the same description and must not be modified.
     public: ElementPtr_V elementDescriptions;
 
+    /// \brief Index of the element descriptions by name. It maps each name
+    /// to the first description with that name, and is shared along with
+    /// `elementDescriptions`. It must not be modified while it is shared.
+    public: std::shared_ptr<std::unordered_map<std::string, ElementPtr>>
+        elementDescriptionIndex;
+
     /// \brief The <include> element that was used to load this entity. For
     /// example, given the following SDFormat:
     /// <sdf version='1.8'>
@@ -918,13 +987,13 @@ namespace sdf
     public: ElementPtr includeElement;
 
     /// \brief Name of reference sdf.
-    public: std::string referenceSDF;
+    public: InternedString referenceSDF;
 
     /// \brief Path to file where this element came from
-    public: std::string path;
+    public: InternedString path;
 
     /// \brief Spec version that this was originally parsed from.
-    public: std::string originalVersion;
+    public: InternedString originalVersion;
 
     /// \brief True if the element was set in the SDF file.
     public: bool explicitlySetInFile;
@@ -952,6 +1021,45 @@ namespace sdf
                                  bool _includeDefaultAttributes,
                                  const PrintConfig &_config,
                                  std::ostringstream &_out) const;
+
+    /// \brief Append a child element and add it to the name index.
+    /// \param[in] _elem Child element to append.
+    public: void AppendElement(ElementPtr _elem);
+
+    /// \brief Remove a child element and drop it from the name index.
+    /// \param[in] _iter Iterator to the child element in `elements`.
+    public: void EraseElement(ElementPtr_V::iterator _iter);
+
+    /// \brief Remove all child elements and clear the name index.
+    public: void ClearElements();
+
+    /// \brief Build the name index and the sibling positions from
+    /// `elements`.
+    public: void ReindexElements();
+
+    /// \brief Move a child element to a new name in the name index. This
+    /// must be called before the child is renamed.
+    /// \param[in] _elem Child element being renamed.
+    /// \param[in] _name New name of the child element.
+    public: void RenameElement(const Element *_elem, const std::string &_name);
+
+    /// \brief Find the first child element with the given name.
+    /// \param[in] _name Name of the child element.
+    /// \return The child element, or nullptr if there is none.
+    public: ElementPtr FindElement(const std::string &_name) const;
+
+    /// \brief Share the element descriptions of another element.
+    /// \param[in] _other Element whose descriptions are shared.
+    public: void ShareElementDescriptions(const ElementPrivate &_other);
+
+    /// \brief Append an element description and add it to the name index.
+    /// \param[in] _elem Element description to append.
+    public: void AppendElementDescription(ElementPtr _elem);
+
+    /// \brief Find the first element description with the given name.
+    /// \param[in] _name Name of the element description.
+    /// \return The element description, or nullptr if there is none.
+    public: ElementPtr FindElementDescription(const std::string &_name) const;
   };
 
   ///////////////////////////////////////////////
@@ -959,21 +1067,22 @@ namespace sdf
   T Element::Get(sdf::Errors &_errors, const std::string &_key) const
   {
     T result = T();
-
-    std::pair<T, bool> ret = this->Get<T>(_errors, _key, result);
-
-    return ret.first;
+    this->GetImpl<T>(_errors, _key, result);
+    return result;
   }
 
   ///////////////////////////////////////////////
   template<typename T>
   T Element::Get(const std::string &_key) const
   {
+    sdf::Errors errors;
     T result = T();
-
-    std::pair<T, bool> ret = this->Get<T>(_key, result);
-
-    return ret.first;
+    this->GetImpl<T>(errors, _key, result);
+    for(auto& error : errors)
+    {
+      internal::throwOrPrintError(sdferr, error);
+    }
+    return result;
   }
 
   ///////////////////////////////////////////////
@@ -983,9 +1092,8 @@ namespace sdf
                     T &_param,
                     const T &_defaultValue) const
   {
-    std::pair<T, bool> ret = this->Get<T>(_errors, _key, _defaultValue);
-    _param = ret.first;
-    return ret.second;
+    _param = _defaultValue;
+    return this->GetImpl<T>(_errors, _key, _param);
   }
 
   ///////////////////////////////////////////////
@@ -994,9 +1102,13 @@ namespace sdf
                     T &_param,
                     const T &_defaultValue) const
   {
-    std::pair<T, bool> ret = this->Get<T>(_key, _defaultValue);
-    _param = ret.first;
-    return ret.second;
+    sdf::Errors errors;
+    bool result = this->Get<T>(errors, _key, _param, _defaultValue);
+    for(auto& error : errors)
+    {
+      internal::throwOrPrintError(sdferr, error);
+    }
+    return result;
   }
 
   ///////////////////////////////////////////////
@@ -1020,37 +1132,40 @@ namespace sdf
                                   const T &_defaultValue) const
   {
     std::pair<T, bool> result(_defaultValue, true);
+    result.second = this->GetImpl<T>(_errors, _key, result.first);
+    return result;
+  }
 
-    if (_key.empty() && this->dataPtr->value)
-    {
-      this->dataPtr->value->Get<T>(result.first, _errors);
-    }
-    else if (!_key.empty())
+  ///////////////////////////////////////////////
+  template<typename T>
+  bool Element::GetImpl(sdf::Errors &_errors,
+                        const std::string &_key,
+                        T &_value) const
+  {
+    if (_key.empty())
     {
-      ParamPtr param = this->GetAttribute(_key);
-      if (param)
-      {
-        param->Get(result.first, _errors);
-      }
-      else if (this->HasElement(_key))
-      {
-        result.first = this->GetElementImpl(_key)->Get<T>(_errors);
-      }
-      else if (this->HasElementDescription(_key))
-      {
-        result.first = this->GetElementDescription(_key)->Get<T>(_errors);
-      }
-      else
-      {
-        result.second = false;
-      }
+      if (!this->dataPtr->value)
+        return false;
+      this->dataPtr->value->Get<T>(_value, _errors);
+      return true;
     }
-    else
+
+    if (const ParamPtr param = this->GetAttribute(_key))
     {
-      result.second = false;
+      param->Get<T>(_value, _errors);
+      return true;
     }
 
-    return result;
+    ElementConstPtr child = this->GetElementImpl(_key);
+    if (!child)
+      child = this->GetElementDescription(_key);
+    if (!child)
+      return false;
+
+    // A child element without a value reads as a default constructed value
+    if (!child->GetImpl<T>(_errors, "", _value))
+      _value = T();
+    return true;
   }
 
   ///////////////////////////////////////////////
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef SDF_INTERNEDSTRING_HH_
+#define SDF_INTERNEDSTRING_HH_
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "sdf/sdf_config.h"
+#include "sdf/system_util.hh"
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::shared_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+  //
+
+  /// \brief Handle to an immutable string stored in a process-wide pool.
+  ///
+  /// Interning the same value twice yields handles that share one copy of
+  /// the string, so element and param metadata that repeats across a
+  /// document, such as names, types, descriptions and file paths, is stored
+  /// once. Copying a handle does not copy the string. A pooled string is
+  /// released when its last handle is destroyed.
+  class SDFORMAT_VISIBLE InternedString
+  {
+    /// \brief Construct a handle to the empty string.
+    public: InternedString() = default;
+
+    /// \brief Construct a handle to an interned copy of a string.
+    /// \param[in] _value String to intern.
+    public: explicit InternedString(const std::string &_value);
+
+    /// \brief Replace the value of this handle with an interned copy of a
+    /// string.
+    /// \param[in] _value String to intern.
+    /// \return Reference to this handle.
+    public: InternedString &operator=(const std::string &_value);
+
+    /// \brief Get the string value.
+    /// \return The interned string.
+    public: const std::string &String() const;
+
+    /// \brief Get the string value.
+    /// \return The interned string.
+    public: operator const std::string &() const;
+
+    /// \brief Check whether the string is empty.
+    /// \return True if the string is empty.
+    public: bool Empty() const;
+
+    /// \brief Reset this handle to the empty string.
+    public: void Clear();
+
+    /// \brief Get the number of distinct strings currently in the pool.
+    /// \return Number of pooled strings.
+    public: static std::size_t PoolSize();
+
+    /// \brief Pooled string, or nullptr for the empty string.
+    private: std::shared_ptr<const std::string> value;
+  };
+
+  /// \brief Compare two interned strings. This only compares pointers.
+  /// \param[in] _a First string.
+  /// \param[in] _b Second string.
+  /// \return True if the strings are equal.
+  SDFORMAT_VISIBLE
+  bool operator==(const InternedString &_a, const InternedString &_b);
+
+  /// \brief Compare an interned string with a string.
+  /// \param[in] _a Interned string.
+  /// \param[in] _b String.
+  /// \return True if the strings are equal.
+  SDFORMAT_VISIBLE
+  bool operator==(const InternedString &_a, const std::string &_b);
+
+  /// \brief Compare a string with an interned string.
+  /// \param[in] _a String.
+  /// \param[in] _b Interned string.
+  /// \return True if the strings are equal.
+  SDFORMAT_VISIBLE
+  bool operator==(const std::string &_a, const InternedString &_b);
+
+  /// \brief Compare two interned strings.
+  /// \param[in] _a First string.
+  /// \param[in] _b Second string.
+  /// \return True if the strings differ.
+  SDFORMAT_VISIBLE
+  bool operator!=(const InternedString &_a, const InternedString &_b);
+
+  /// \brief Compare an interned string with a string.
+  /// \param[in] _a Interned string.
+  /// \param[in] _b String.
+  /// \return True if the strings differ.
+  SDFORMAT_VISIBLE
+  bool operator!=(const InternedString &_a, const std::string &_b);
+
+  /// \brief Compare a string with an interned string.
+  /// \param[in] _a String.
+  /// \param[in] _b Interned string.
+  /// \return True if the strings differ.
+  SDFORMAT_VISIBLE
+  bool operator!=(const std::string &_a, const InternedString &_b);
+
+  /// \brief Write an interned string to a stream.
+  /// \param[in] _out Output stream.
+  /// \param[in] _str String to write.
+  /// \return The output stream.
+  SDFORMAT_VISIBLE
+  std::ostream &operator<<(std::ostream &_out, const InternedString &_str);
+  }
+}
+
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <gz/math/Pose3.hh>
@@ -555,9 +556,34 @@ namespace sdf
     private: sdf::Frame PrepareForMerge(sdf::Errors &_errors,
                                         const std::string &_parentOfProxyFrame);
 
+    /// \brief Get a link by name without copying the name. This is the
+    /// implementation of LinkByName.
+    /// \param[in] _name Name of the link, which can be scoped.
+    /// \return Pointer to the link, nullptr if it was not found.
+    private: const Link *LinkByNameView(std::string_view _name) const;
+
+    /// \brief Get a joint by name without copying the name. This is the
+    /// implementation of JointByName.
+    /// \param[in] _name Name of the joint, which can be scoped.
+    /// \return Pointer to the joint, nullptr if it was not found.
+    private: const Joint *JointByNameView(std::string_view _name) const;
+
+    /// \brief Get an explicit frame by name without copying the name. This is
+    /// the implementation of FrameByName.
+    /// \param[in] _name Name of the frame, which can be scoped.
+    /// \return Pointer to the frame, nullptr if it was not found.
+    private: const Frame *FrameByNameView(std::string_view _name) const;
+
+    /// \brief Get a nested model by name without copying the name. This is
+    /// the implementation of ModelByName.
+    /// \param[in] _name Name of the nested model, which can be scoped.
+    /// \return Pointer to the model, nullptr if it was not found.
+    private: const Model *ModelByNameView(std::string_view _name) const;
+
     /// \brief Allow Root::Load, World::SetPoseRelativeToGraph, or
     /// World::SetFrameAttachedToGraph to call SetPoseRelativeToGraph and
-    /// SetFrameAttachedToGraph
+    /// SetFrameAttachedToGraph, and the World lookups by name to call the
+    /// *ByNameView functions.
     friend class Root;
     friend class World;
 
@@ -20,12 +20,14 @@
 
 #include <any>
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -41,6 +43,7 @@
 #include <gz/math/Vector3.hh>
 
 #include "sdf/Console.hh"
+#include "sdf/InternedString.hh"
 #include "sdf/PrintConfig.hh"
 #include "sdf/sdf_config.h"
 #include "sdf/system_util.hh"
@@ -305,6 +308,27 @@ namespace sdf
     public: bool SetFromString(const std::string &_value,
                                sdf::Errors &_errors);
 
+    /// \brief Set the parameter value from a string without parsing it yet.
+    /// The string is parsed, and checked against the minimum and maximum
+    /// allowed values, the first time the value is read, e.g. by Get(),
+    /// GetAny(), GetAsString() or ValidateValue(). If the string is
+    /// invalid, that read and every later one report the errors, and return
+    /// the previous value, until the parameter is set again. Empty strings
+    /// are handled right away, as by SetFromString(). Concurrent reads of a
+    /// parameter with a pending value are safe, but it must not be set
+    /// while it is read.
+    /// \param[in] _value Value to set the parameter to.
+    /// \return True if the string was accepted.
+    public: bool SetFromStringDeferred(const std::string &_value);
+
+    /// \brief Set the parameter value from a string without parsing it yet.
+    /// \sa SetFromStringDeferred(const std::string &)
+    /// \param[in] _value Value to set the parameter to.
+    /// \param[out] _errors Vector of errors.
+    /// \return True if the string was accepted.
+    public: bool SetFromStringDeferred(const std::string &_value,
+                                       sdf::Errors &_errors);
+
     /// \brief Get the parent Element of this Param.
     /// \return Pointer to this Param's parent Element, nullptr if there is no
     /// parent Element.
@@ -448,6 +472,23 @@ namespace sdf
             bool Get(T &_value,
                      sdf::Errors &_errors) const;
 
+    /// \brief Get a pointer to the value of the parameter if it holds a
+    /// value of type T. Unlike Get, this never copies the value or converts
+    /// it from another type.
+    /// \return Pointer to the value, valid until the value of the parameter
+    /// changes, or nullptr if the parameter holds a value of another type.
+    public: template<typename T>
+            const T *GetIf() const;
+
+    /// \brief Get a pointer to the value of the parameter if it holds a
+    /// value of type T. Unlike Get, this never copies the value or converts
+    /// it from another type.
+    /// \param[out] _errors Vector of errors.
+    /// \return Pointer to the value, valid until the value of the parameter
+    /// changes, or nullptr if the parameter holds a value of another type.
+    public: template<typename T>
+            const T *GetIf(sdf::Errors &_errors) const;
+
     /// \brief Get the default value of the parameter.
     /// \param[out] _value The default value of the parameter.
     /// \return True if parameter was successfully cast to the value type
@@ -492,6 +533,19 @@ namespace sdf
       return _out;
     }
 
+    /// \brief Parse the value set by SetFromStringDeferred, if it has not
+    /// been parsed yet.
+    /// \param[out] _errors Vector of errors.
+    /// \return True if there was no pending value or it was parsed and is
+    /// within the allowed range.
+    private: bool ParsePendingValue(sdf::Errors &_errors) const;
+
+    /// \brief Check the parsed value against the minimum and maximum
+    /// allowed values, without parsing a pending value first.
+    /// \param[out] _errors Vector of errors.
+    /// \return True if the value is within the allowed range.
+    private: bool ValidateParsedValue(sdf::Errors &_errors) const;
+
     /// \brief Private data
     private: std::unique_ptr<ParamPrivate> dataPtr;
   };
@@ -500,26 +554,28 @@ namespace sdf
   /// \brief Private data for the param class
   class ParamPrivate
   {
-    /// \brief Key value
-    public: std::string key;
-
-    /// \brief True if the parameter is required.
-    public: bool required;
-
-    /// \brief True if the parameter is set.
-    public: bool set;
-
-    //// \brief Name of the type.
-    public: std::string typeName;
-
-    /// \brief Description of the parameter.
-    public: std::string description;
-
-    /// \brief Parent element.
-    public: ElementWeakPtr parentElement;
-
-    /// \brief Update function pointer.
-    public: std::function<std::any ()> updateFunc;
+    /// \brief Kinds of values a parameter can hold. Each kind matches an
+    /// alternative of ParamVariant.
+    public: enum class ValueType : std::uint8_t
+    {
+      UNKNOWN,
+      BOOL,
+      CHAR,
+      STRING,
+      INT,
+      UINT64,
+      UNSIGNED_INT,
+      DOUBLE,
+      FLOAT,
+      TIME,
+      ANGLE,
+      COLOR,
+      VECTOR2I,
+      VECTOR2D,
+      VECTOR3D,
+      QUATERNION,
+      POSE
+    };
 
     /// \def ParamVariant
     /// \brief Variant type def.
@@ -536,28 +592,100 @@ namespace sdf
                                    gz::math::Quaterniond,
                                    gz::math::Pose3d> ParamVariant;
 
-    /// \brief This parameter's value
-    public: ParamVariant value;
+    /// \brief Data of a parameter that comes from its SDFormat description.
+    /// It is the same for every parameter copied from the same description,
+    /// e.g. the value of every <pose> element of a document, so copies of a
+    /// parameter share it. It is never modified once shared.
+    public: class Descriptor
+    {
+      /// \brief Key value
+      public: InternedString key;
+
+      /// \brief True if the parameter is required.
+      public: bool required = false;
+
+      /// \brief Kind of value, resolved from the type name when the
+      /// parameter is initialized.
+      public: ValueType valueType = ValueType::UNKNOWN;
+
+      //// \brief Name of the type.
+      public: InternedString typeName;
+
+      /// \brief Description of the parameter.
+      public: InternedString description;
+
+      /// \brief This parameter's default value that was provided as a string
+      public: InternedString defaultStrValue;
+
+      /// \brief This parameter's default value
+      public: ParamVariant defaultValue;
+
+      /// \brief This parameter's minimum allowed value
+      public: std::optional<ParamVariant> minValue;
+
+      /// \brief This parameter's maximum allowed value
+      public: std::optional<ParamVariant> maxValue;
+    };
+
+    /// \brief Data shared with the copies of this parameter.
+    public: std::shared_ptr<const Descriptor> descriptor;
+
+    /// \brief True if the parameter is set.
+    public: bool set = false;
 
     /// \brief True if the value has been parsed while ignoring its parent
     /// element's attributes, and will continue to ignore them for subsequent
     /// reparses.
-    public: bool ignoreParentAttributes;
+    public: bool ignoreParentAttributes = false;
+
+    /// \brief This parameter's value
+    public: ParamVariant value;
 
     /// \brief This parameter's value that was provided as a string
     public: std::optional<std::string> strValue;
 
-    /// \brief This parameter's default value that was provided as a string
-    public: std::string defaultStrValue;
+    /// \brief Value provided with Param::SetFromStringDeferred that has not
+    /// been parsed into value yet.
+    public: class PendingValue
+    {
+      /// \brief Constructor.
+      public: PendingValue() = default;
+
+      /// \brief Copy constructor. The copy has its own mutex.
+      /// \param[in] _other Pending value to copy.
+      public: PendingValue(const PendingValue &_other);
+
+      /// \brief Copy assignment operator. The mutex is not copied.
+      /// \param[in] _other Pending value to copy.
+      /// \return Reference to this pending value.
+      public: PendingValue &operator=(const PendingValue &_other);
+
+      /// \brief Discard the pending value and its errors.
+      public: void Clear();
+
+      /// \brief String still to be parsed. It is kept if parsing fails.
+      public: std::optional<std::string> str;
 
-    /// \brief This parameter's default value
-    public: ParamVariant defaultValue;
+      /// \brief Errors found when str failed to parse, reported again by
+      /// every read. Unset if str has not been parsed yet.
+      public: std::optional<sdf::Errors> errors;
 
-    /// \brief This parameter's minimum allowed value
-    public: std::optional<ParamVariant> minValue;
+      /// \brief True while str is set, so reads can skip the mutex once
+      /// the value is parsed.
+      public: std::atomic<bool> active{false};
 
-    /// \brief This parameter's maximum allowed value
-    public: std::optional<ParamVariant> maxValue;
+      /// \brief Serializes the parse of str between concurrent reads.
+      public: mutable std::mutex mutex;
+    };
+
+    /// \brief Pending value, if any.
+    public: PendingValue pending;
+
+    /// \brief Parent element.
+    public: ElementWeakPtr parentElement;
+
+    /// \brief Update function pointer.
+    public: std::function<std::any ()> updateFunc;
 
     /// \brief Initializer function to help Param constructors.
     /// \param[in] _key Key for the parameter.
@@ -600,6 +728,24 @@ namespace sdf
                                     ParamVariant &_valueToSet,
                                     sdf::Errors &_errors) const;
 
+    /// \brief Method used to set the Param from a passed-in string
+    /// \param[in] _valueType The kind of value to set
+    /// \param[in] _valueStr The value as a string
+    /// \param[out] _valueToSet The value to set
+    /// \param[out] _errors Vector of errors.
+    /// \return True if the value was successfully set, false otherwise
+    public: bool SDFORMAT_VISIBLE ValueFromStringImpl(
+                                    ValueType _valueType,
+                                    const std::string &_valueStr,
+                                    ParamVariant &_valueToSet,
+                                    sdf::Errors &_errors) const;
+
+    /// \brief Get the kind of value named by a type name.
+    /// \param[in] _typeName Name of the type, e.g. "double" or "pose".
+    /// \return The kind of value, ValueType::UNKNOWN if the type name is not
+    /// supported.
+    public: static ValueType ValueTypeFromName(const std::string &_typeName);
+
     /// \brief Method used to get the string representation from a ParamVariant,
     /// or the string that was used to set it.
     /// \param[in] _config Print configuration for the string output
@@ -619,6 +765,11 @@ namespace sdf
     /// \return The type as a string, empty string if unknown type
     public: template<typename T>
             static std::string TypeToString();
+
+    /// \brief Data type to kind of value mapping
+    /// \return The kind of value, ValueType::UNKNOWN if unknown type
+    public: template<typename T>
+            static constexpr ValueType TypeToValueType();
   };
 
   ///////////////////////////////////////////////
@@ -662,6 +813,46 @@ namespace sdf
       return "";
   }
 
+  ///////////////////////////////////////////////
+  template<typename T>
+  constexpr ParamPrivate::ValueType ParamPrivate::TypeToValueType()
+  {
+    if constexpr (std::is_same_v<T, bool>)
+      return ValueType::BOOL;
+    else if constexpr (std::is_same_v<T, char>)
+      return ValueType::CHAR;
+    else if constexpr (std::is_same_v<T, std::string>)
+      return ValueType::STRING;
+    else if constexpr (std::is_same_v<T, int>)
+      return ValueType::INT;
+    else if constexpr (std::is_same_v<T, std::uint64_t>)
+      return ValueType::UINT64;
+    else if constexpr (std::is_same_v<T, unsigned int>)
+      return ValueType::UNSIGNED_INT;
+    else if constexpr (std::is_same_v<T, double>)
+      return ValueType::DOUBLE;
+    else if constexpr (std::is_same_v<T, float>)
+      return ValueType::FLOAT;
+    else if constexpr (std::is_same_v<T, sdf::Time>)
+      return ValueType::TIME;
+    else if constexpr (std::is_same_v<T, gz::math::Angle>)
+      return ValueType::ANGLE;
+    else if constexpr (std::is_same_v<T, gz::math::Color>)
+      return ValueType::COLOR;
+    else if constexpr (std::is_same_v<T, gz::math::Vector2i>)
+      return ValueType::VECTOR2I;
+    else if constexpr (std::is_same_v<T, gz::math::Vector2d>)
+      return ValueType::VECTOR2D;
+    else if constexpr (std::is_same_v<T, gz::math::Vector3d>)
+      return ValueType::VECTOR3D;
+    else if constexpr (std::is_same_v<T, gz::math::Quaterniond>)
+      return ValueType::QUATERNION;
+    else if constexpr (std::is_same_v<T, gz::math::Pose3d>)
+      return ValueType::POSE;
+    else
+      return ValueType::UNKNOWN;
+  }
+
   ///////////////////////////////////////////////
   template<typename T>
   void Param::SetUpdateFunc(T _updateFunc)
@@ -694,7 +885,7 @@ namespace sdf
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "Unable to set parameter["
-          + this->dataPtr->key + "]."
+          + this->dataPtr->descriptor->key.String() + "]."
           + "Type used must have a stream input and output operator,"
           + "which allows proper functioning of Param."});
       return false;
@@ -716,15 +907,16 @@ namespace sdf
   template<typename T>
   bool Param::Get(T &_value, sdf::Errors &_errors) const
   {
-    T *value = std::get_if<T>(&this->dataPtr->value);
+    const T *value = this->GetIf<T>(_errors);
     if (value)
     {
       _value = *value;
     }
     else
     {
-      std::string typeStr = this->dataPtr->TypeToString<T>();
-      if (typeStr.empty())
+      constexpr ParamPrivate::ValueType valueType =
+          ParamPrivate::TypeToValueType<T>();
+      if (valueType == ParamPrivate::ValueType::UNKNOWN)
       {
         _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
             "Unknown parameter type[" + std::string(typeid(T).name()) + "]"});
@@ -734,13 +926,14 @@ namespace sdf
       std::string valueStr = this->GetAsString(_errors);
       ParamPrivate::ParamVariant pv;
       bool success = this->dataPtr->ValueFromStringImpl(
-          typeStr, valueStr, pv, _errors);
+          valueType, valueStr, pv, _errors);
 
       if (success)
       {
         _value = std::get<T>(pv);
       }
-      else if (typeStr == "bool" && this->dataPtr->typeName == "string")
+      else if (valueType == ParamPrivate::ValueType::BOOL &&
+               this->dataPtr->descriptor->typeName == "string")
       {
         // this section for handling bool types is to keep backward behavior
         // TODO(anyone) remove for Fortress. For more details:
@@ -763,6 +956,28 @@ namespace sdf
     return true;
   }
 
+  ///////////////////////////////////////////////
+  template<typename T>
+  const T *Param::GetIf() const
+  {
+    sdf::Errors errors;
+    const T *result = this->GetIf<T>(errors);
+    if (!errors.empty())
+      sdferr << errors;
+    return result;
+  }
+
+  ///////////////////////////////////////////////
+  template<typename T>
+  const T *Param::GetIf(sdf::Errors &_errors) const
+  {
+    // A value that fails to parse is reported, and the previous value is
+    // returned, as if it had been rejected by SetFromString.
+    this->ParsePendingValue(_errors);
+
+    return std::get_if<T>(&this->dataPtr->value);
+  }
+
   ///////////////////////////////////////////////
   template<typename T>
   bool Param::GetDefault(T &_value) const
@@ -782,7 +997,7 @@ namespace sdf
 
     try
     {
-      ss << ParamStreamer{this->dataPtr->defaultValue,
+      ss << ParamStreamer{this->dataPtr->descriptor->defaultValue,
                           std::numeric_limits<int>::max()};
       ss >> _value;
     }
@@ -790,9 +1005,9 @@ namespace sdf
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "Unable to convert parameter["
-          + this->dataPtr->key + "] "
+          + this->dataPtr->descriptor->key.String() + "] "
           + "whose type is["
-          + this->dataPtr->typeName + "], to "
+          + this->dataPtr->descriptor->typeName.String() + "], to "
           + "type[" + typeid(T).name() + "]"});
       return false;
     }
@@ -18,8 +18,11 @@
 #ifndef SDF_PARSER_CONFIG_HH_
 #define SDF_PARSER_CONFIG_HH_
 
+#include <cstddef>
 #include <functional>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -65,6 +68,9 @@ enum class ConfigureResolveAutoInertials
 
 // Forward declare private data class.
 class ParserConfigPrivate;
+class FindFileCache;
+class IncludeCache;
+class ParserConfigCaches;
 
 /// This class contains configuration options for the libsdformat parser.
 ///
@@ -96,6 +102,14 @@ class ParserConfigPrivate;
 ///   sdf::Root root;
 ///   root.Load("path/to/file.sdf", config);
 /// \endcode
+///
+/// Documents can be read and loaded by several threads at once, e.g. with
+/// sdf::readFile() or \ref Root::Load "sdf::Root::Load()", as long as each
+/// thread loads into its own objects. The ParserConfig objects used by the
+/// loads, including the singleton, are only read while loading, so they
+/// can be shared between threads, but must not be modified while a load
+/// that uses them is in progress. Callbacks of a shared ParserConfig, such
+/// as the find file callback, may be called from several threads at once.
 class SDFORMAT_VISIBLE ParserConfig
 {
   /// type alias for the map from URI scheme to search directories
@@ -235,6 +249,189 @@ class SDFORMAT_VISIBLE ParserConfig
   /// store them.  False to preserve original URIs
   public: bool StoreResolvedURIs() const;
 
+  /// \brief Set whether the elements and params of documents read by
+  /// sdf::readFile() and sdf::readString() are allocated from a per-document
+  /// arena. Each sdf::Element and sdf::Param object comes from the arena
+  /// together with the control block of its shared pointer, which saves one
+  /// heap allocation per node. Their private data, and the strings and
+  /// containers it owns, are still allocated on the heap. The arena memory
+  /// of a document is released at once when its last element or param is
+  /// destroyed. Included files, including those read in parallel, share the
+  /// arena of the document that includes them.
+  /// \param[in] _arenaAllocation True to allocate from an arena, false to
+  /// allocate each node on the heap. The default is false.
+  public: void SetArenaAllocation(bool _arenaAllocation);
+
+  /// \brief Get whether the elements and params of documents are allocated
+  /// from a per-document arena.
+  /// \return True if nodes are allocated from an arena.
+  public: bool ArenaAllocation() const;
+
+  /// \brief Set whether the parser records where each element was read
+  /// from, i.e. the values returned by Element::LineNumber() and
+  /// Element::XmlPath(). Building the XML path of every element costs time
+  /// and memory that grows with the nesting depth, which can be skipped when
+  /// nobody inspects it. When disabled, errors reported while parsing still
+  /// contain the file path and line number, but no XML path. Element file
+  /// paths are always recorded, since they are needed to resolve relative
+  /// URIs.
+  /// \param[in] _sourceTracing True to record line numbers and XML paths of
+  /// elements, false to skip them. The default is true.
+  public: void SetSourceTracing(bool _sourceTracing);
+
+  /// \brief Get whether the parser records the line number and XML path of
+  /// each element.
+  /// \return True if line numbers and XML paths are recorded.
+  public: bool SourceTracing() const;
+
+  /// \brief Set whether the parser keeps the text of element values and
+  /// attributes, and parses it only when the value is first read, see
+  /// Param::SetFromStringDeferred. Most documents are loaded into DOM
+  /// objects that read a small fraction of their params, so this saves the
+  /// cost of parsing the rest. Invalid and out of range values are then
+  /// reported by the call that first reads them, e.g. the Load() function of
+  /// a DOM object, instead of by sdf::readFile() or sdf::readString().
+  /// \param[in] _lazyValueParsing True to parse values when first read,
+  /// false to parse them while reading the document. The default is false.
+  public: void SetLazyValueParsing(bool _lazyValueParsing);
+
+  /// \brief Get whether the parser parses values when they are first read.
+  /// \return True if values are parsed when first read.
+  public: bool LazyValueParsing() const;
+
+  /// \brief Set whether documents are read by a streaming reader, which
+  /// builds the elements while it reads the XML, instead of first building
+  /// a tinyxml2 document. This lowers the peak memory used to read large
+  /// documents, e.g. generated worlds. Files are read in place from a
+  /// memory mapping. The elements are built by the same code as with the
+  /// default reader, so they are the same.
+  ///
+  /// Only <include> elements, elements whose children are copied, such as
+  /// <plugin>, and elements not defined in SDF are parsed into tinyxml2
+  /// elements. URDF documents and documents that must be converted from an
+  /// older version of the specification are read by the default reader.
+  /// The XML is checked while it is read, so the errors and warnings about
+  /// the elements before an XML error, or before an invalid top level
+  /// pose, are reported too. This only affects sdf::readFile() and
+  /// sdf::readString() with an SDFPtr, and so sdf::Root::Load().
+  /// \param[in] _streamingParsing True to use the streaming reader. The
+  /// default is false.
+  public: void SetStreamingParsing(bool _streamingParsing);
+
+  /// \brief Get whether documents are read by a streaming reader.
+  /// \return True if documents are read by a streaming reader.
+  public: bool StreamingParsing() const;
+
+  /// \brief Set whether the documents read for <include> elements are
+  /// cached, so that a file included many times is only read once. Later
+  /// includes of the file get a copy of the cached document, to which the
+  /// overrides of the include, e.g. its name and pose, are applied. A cached
+  /// document is read again when the modification time of its file
+  /// changes, but not when files that it includes change.
+  ///
+  /// The cache is shared by copies of this config, and used by every load
+  /// that uses one of them, so a world loaded several times only reads its
+  /// included files once. Disabling caching releases the cache. Changing a
+  /// setting that affects how files are found or read, such as the URI
+  /// paths, the find file callback or the policies, replaces the cache of
+  /// this config by an empty one. The warnings printed when a file was read
+  /// are printed again for each later include of it.
+  /// \param[in] _includeCaching True to cache included files. The default
+  /// is false.
+  public: void SetIncludeCaching(bool _includeCaching);
+
+  /// \brief Get whether the documents read for <include> elements are
+  /// cached.
+  /// \return True if included files are cached.
+  public: bool IncludeCaching() const;
+
+  /// \brief Set the number of threads used to read the files of the
+  /// <include> elements of a document. The included files of each element
+  /// are read in parallel, and then inserted in document order, so the
+  /// loaded document and the reported errors are the same as when they are
+  /// read one at a time. The threads are shared by all the included files
+  /// of a load, including the files included by included files, and the
+  /// thread that loads the document is one of them.
+  ///
+  /// The find file callback is called for the includes of an element in
+  /// document order, once the files of the previous includes are read, and
+  /// is not called for the includes that follow a file that failed to be
+  /// read. Includes that need the callback are therefore read after the
+  /// previous ones. The callback and custom model parsers may be called by
+  /// several threads at once, for the files included by different included
+  /// files. Messages printed to the console while reading included files
+  /// may be in a different order.
+  /// \param[in] _threadCount Number of threads. 0 and 1 read the files one
+  /// at a time on the thread that loads the document. The default is 1.
+  public: void SetIncludeThreadCount(unsigned int _threadCount);
+
+  /// \brief Get the number of threads used to read the files of the
+  /// <include> elements of a document.
+  /// \return Number of threads, 0 or 1 if the files are read one at a time.
+  public: unsigned int IncludeThreadCount() const;
+
+  /// \brief Set whether the paths found by sdf::findFile() are cached, so
+  /// that a URI used many times, e.g. by the includes and meshes of a world,
+  /// is only looked up once. Lookups that found no file, and the results of
+  /// the find file callback, are cached too.
+  ///
+  /// The cache is shared by copies of this config. It is replaced by an
+  /// empty one when the URI path map or the find file callback of this
+  /// config changes. Changes to the filesystem or to the SDF_PATH
+  /// environment variable are not noticed until ClearFindFileCache() is
+  /// called.
+  /// \param[in] _findFileCaching True to cache the paths found. The default
+  /// is false.
+  public: void SetFindFileCaching(bool _findFileCaching);
+
+  /// \brief Get whether the paths found by sdf::findFile() are cached.
+  /// \return True if the paths found are cached.
+  public: bool FindFileCaching() const;
+
+  /// \brief Remove the paths cached by sdf::findFile(), so that they are
+  /// looked up again, e.g. after files were added. This also affects the
+  /// copies of this config that share the cache.
+  public: void ClearFindFileCache();
+
+  /// \brief Get the number of sdf::findFile() calls answered by the cache.
+  /// \return Number of cache hits, 0 if the paths found are not cached.
+  public: std::size_t FindFileCacheHitCount() const;
+
+  /// \brief Get the number of sdf::findFile() calls that were not in the
+  /// cache, and so searched for the file.
+  /// \return Number of cache misses, 0 if the paths found are not cached.
+  public: std::size_t FindFileCacheMissCount() const;
+
+  /// \brief Set the names of elements that are skipped when documents are
+  /// read, e.g. "visual", "gui" or "plugin" for consumers that do not
+  /// render. The whole subtree of a skipped element is ignored, so neither
+  /// its elements nor its DOM objects are ever created. A skipped element
+  /// that is required is not added with its default value either.
+  ///
+  /// Only elements described by the specification are skipped. Elements
+  /// that are not, such as custom elements, and the contents of elements
+  /// that are copied verbatim, such as plugins, are read as usual. If
+  /// included files are cached, the cache is replaced by an empty one.
+  /// \param[in] _names Names of the elements to skip. The default is an
+  /// empty set.
+  public: void SetSkippedElements(const std::set<std::string> &_names);
+
+  /// \brief Get the names of elements that are skipped when documents are
+  /// read.
+  /// \return Names of the skipped elements.
+  public: const std::set<std::string> &SkippedElements() const;
+
+  /// \brief Get the cache of included files used by the parser.
+  /// \return The cache, or nullptr if included files are not cached.
+  private: std::shared_ptr<IncludeCache> IncludeFileCache() const;
+
+  /// \brief Get the cache of paths found by sdf::findFile().
+  /// \return The cache, or nullptr if the paths found are not cached.
+  private: std::shared_ptr<FindFileCache> FindFileResults() const;
+
+  /// \brief Allow the parser to reach the caches of the config.
+  friend class ParserConfigCaches;
+
   /// \brief Private data pointer.
   GZ_UTILS_IMPL_PTR(dataPtr)
 };
@@ -18,6 +18,7 @@
 #define SDF_ROOT_HH_
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <gz/utils/ImplPtr.hh>
 
@@ -102,6 +103,26 @@ namespace sdf
     public: Errors LoadSdfString(
                 const std::string &_sdf, const ParserConfig &_config);
 
+    /// \brief Parse the given SDF string, and generate objects based on types
+    /// specified in the SDF file.
+    /// The string is parsed in place, without being copied, and does not
+    /// need to be null terminated.
+    /// \param[in] _sdf SDF string to parse.
+    /// \param[in] _config Custom parser configuration
+    /// \return Errors, which is a vector of Error objects. Each Error includes
+    /// an error code and message. An empty vector indicates no error.
+    public: Errors LoadSdfString(
+                std::string_view _sdf, const ParserConfig &_config);
+
+    /// \brief Parse the given null terminated SDF string. This overload
+    /// makes calls with string literals unambiguous.
+    /// \param[in] _sdf SDF string to parse.
+    /// \param[in] _config Custom parser configuration
+    /// \return Errors, which is a vector of Error objects. Each Error includes
+    /// an error code and message. An empty vector indicates no error.
+    public: Errors LoadSdfString(
+                const char *_sdf, const ParserConfig &_config);
+
     /// \brief Parse the given SDF pointer, and generate objects based on types
     /// specified in the SDF file.
     /// \param[in] _sdf SDF pointer to parse.
@@ -85,6 +85,8 @@ namespace sdf
   /// This overload uses the URI path map and and the callback function
   /// configured in the input ParserConfig object instead of their global
   /// counterparts.
+  /// If ParserConfig::FindFileCaching() is enabled, the result of an earlier
+  /// lookup is returned without searching again.
   ///
   /// \param[in] _filename Name of the file to find.
   /// \param[in] _searchLocalPath True to search for the file in the current
@@ -20,6 +20,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <gz/math/SphericalCoordinates.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/utils/ImplPtr.hh>
@@ -538,6 +539,12 @@ namespace sdf
     private: void SetFrameAttachedToGraph(
         sdf::ScopedGraph<FrameAttachedToGraph> _graph);
 
+    /// \brief Get a model by name without copying the name. This is the
+    /// implementation of ModelByName.
+    /// \param[in] _name Name of the model, which can be scoped.
+    /// \return Pointer to the model, nullptr if it was not found.
+    private: const Model *ModelByNameView(std::string_view _name) const;
+
     /// \brief Allow Root::Load to call SetPoseRelativeToGraph and
     /// SetFrameAttachedToGraph
     friend class Root;
@@ -18,6 +18,7 @@
 #define SDF_PARSER_HH_
 
 #include <string>
+#include <string_view>
 
 #include "sdf/SDFImpl.hh"
 #include "sdf/sdf_config.h"
@@ -270,6 +271,32 @@ namespace sdf
   bool readString(const std::string &_xmlString, const ParserConfig &_config,
       SDFPtr _sdf, Errors &_errors);
 
+  /// \brief Populate the SDF values from a string
+  ///
+  /// This populates the SDF pointer from a string. If the string is a URDF
+  /// string it is converted to SDF first. All string are converted to the
+  /// latest SDF version. The string is parsed in place, without being
+  /// copied, and does not need to be null terminated.
+  /// \param[in] _xmlString XML string to be parsed.
+  /// \param[in] _config Custom parser configuration
+  /// \param[out] _sdf Pointer to an SDF object.
+  /// \param[out] _errors Parsing errors will be appended to this variable.
+  /// \return True if successful.
+  SDFORMAT_VISIBLE
+  bool readString(std::string_view _xmlString, const ParserConfig &_config,
+      SDFPtr _sdf, Errors &_errors);
+
+  /// \brief Populate the SDF values from a null terminated string. This
+  /// overload makes calls with string literals unambiguous.
+  /// \param[in] _xmlString XML string to be parsed.
+  /// \param[in] _config Custom parser configuration
+  /// \param[out] _sdf Pointer to an SDF object.
+  /// \param[out] _errors Parsing errors will be appended to this variable.
+  /// \return True if successful.
+  SDFORMAT_VISIBLE
+  bool readString(const char *_xmlString, const ParserConfig &_config,
+      SDFPtr _sdf, Errors &_errors);
+
   /// \brief Populate the SDF values from a string
   ///
   /// This populates the SDF pointer from a string. If the string is a URDF
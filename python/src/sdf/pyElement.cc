@@ -144,13 +144,21 @@ void defineElement(py::object module)
            &Element::GetElementDescriptionCount,
            "Get the number of element descriptions.")
       .def("get_element_description",
-           py::overload_cast<unsigned int>(&Element::GetElementDescription,
-                                           py::const_),
-           "Get an element description using an index")
+           [](const Element &_self, unsigned int _index)
+           {
+             // Descriptions are shared and read-only, so Python gets a copy
+             ElementConstPtr desc = _self.GetElementDescription(_index);
+             return desc ? desc->Clone() : ElementPtr();
+           },
+           "Get a copy of an element description using an index")
       .def("get_element_description",
-           py::overload_cast<const std::string &>(
-               &Element::GetElementDescription, py::const_),
-           "Get an element description using a key")
+           [](const Element &_self, const std::string &_key)
+           {
+             // Descriptions are shared and read-only, so Python gets a copy
+             ElementConstPtr desc = _self.GetElementDescription(_key);
+             return desc ? desc->Clone() : ElementPtr();
+           },
+           "Get a copy of an element description using a key")
       .def("has_element_description", &Element::HasElementDescription,
            "Return true if an element description exists.")
       .def("has_attribute", &Element::HasAttribute,
@@ -1 +1 @@
-from sdformat14 import *
+from sdformat15 import *
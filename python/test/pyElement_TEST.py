@@ -251,6 +251,13 @@ class ElementTEST(unittest.TestCase):
         parent.add_element_description(desc)
         self.assertEqual(parent.get_element_description_count(), 1)
 
+        # Descriptions are shared, so a copy is returned
+        desc.set_name("desc")
+        desc_copy = parent.get_element_description(0)
+        desc_copy.set_name("changed")
+        self.assertEqual("desc",
+                         parent.get_element_description(0).get_name())
+
         parent.add_attribute("test", "string", "foo", False, "foo description")
         self.assertEqual(parent.get_attribute_count(), 1)
 
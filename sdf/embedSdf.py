@@ -3,12 +3,13 @@
 Script for generating a C++ file that contains the content from all SDF files
 """
 
-from typing import List, Optional
+from typing import Dict, List, Optional
 
 import argparse
 import inspect
 import sys
 from pathlib import Path, PurePosixPath
+from xml.dom import minidom
 
 
 # The list of supported SDF specification versions. This will let us drop
@@ -68,7 +69,7 @@ def get_copyright_notice() -> str:
 
 def get_file_header_prolog() -> str:
     """
-    Provides the include statement, namespace and variable declaration of the C++ file
+    Provides the include statement and namespace of the C++ file
 
     :returns: prolog of the C++ file
     """
@@ -80,6 +81,19 @@ def get_file_header_prolog() -> str:
     {
     inline namespace SDF_VERSION_NAMESPACE
     {
+    """
+    )
+    return res + NEWLINE
+
+
+def get_map_prolog() -> str:
+    """
+    Provides the declaration of the function returning the embedded SDF content
+
+    :returns: prolog of the content map
+    """
+    res = inspect.cleandoc(
+        """
     /////////////////////////////////////////////////
     const std::map<std::string, std::string> &GetEmbeddedSdf()
     {
@@ -109,11 +123,11 @@ def embed_sdf_content(arg_path: str, arg_file_content: str) -> str:
     return NEWLINE.join(res)
 
 
-def get_file_header_epilog() -> str:
+def get_map_epilog() -> str:
     """
-    Provides the return statement and the closing brackets of the C++ file
+    Provides the return statement and the closing brackets of a map function
 
-    :returns: epilog of the C++ file
+    :returns: epilog of the content map
     """
     res = inspect.cleandoc(
         """
@@ -121,23 +135,322 @@ def get_file_header_epilog() -> str:
 
         return result;
     }
+    """
+    )
+    return NEWLINE + res + 2 * NEWLINE
+
+
+def get_file_header_epilog() -> str:
+    """
+    Provides the closing brackets of the C++ file
 
+    :returns: epilog of the C++ file
+    """
+    res = inspect.cleandoc(
+        """
     }
     }  // namespace sdf
 
     """
     )
-    return NEWLINE + res
+    return res
+
+
+def cpp_string(arg_value: Optional[str]) -> str:
+    """
+    Generates a C++ string literal
+
+    :param arg_value: Content of the string, or None
+    :returns: escaped string literal, or nullptr if arg_value is None
+    """
+    if arg_value is None:
+        return "nullptr"
+    escaped = (
+        arg_value.replace("\\", "\\\\")
+        .replace('"', '\\"')
+        .replace("\n", "\\n")
+        .replace("\r", "\\r")
+        .replace("\t", "\\t")
+    )
+    return f'"{escaped}"'
+
+
+# Map of the characters tinyxml2 treats as whitespace onto a space
+WHITESPACE_TRANSLATION = str.maketrans("\t\n\r\f\v", "     ")
+
 
+def collapse_whitespace(arg_text: str) -> str:
+    """
+    Collapses whitespace the same way as tinyxml2::COLLAPSE_WHITESPACE, which is
+    the mode used by the parser for the spec files
+
+    :param arg_text: Text to collapse
+    :returns: text without leading and trailing whitespace, in which every other
+        run of whitespace is replaced by a single space
+    """
+    words = arg_text.translate(WHITESPACE_TRANSLATION).split(" ")
+    return " ".join(word for word in words if word)
+
+
+def get_text(arg_element: minidom.Element) -> Optional[str]:
+    """
+    Emulates tinyxml2::XMLElement::GetText on a spec file parsed with
+    tinyxml2::COLLAPSE_WHITESPACE
 
-def write_output(file_content: str, output_filename: str) -> None:
+    :param arg_element: Element to get the text of
+    :returns: text of the element, or None if its first child is not text
+    """
+    for child in arg_element.childNodes:
+        # tinyxml2 does not create nodes for whitespace between tags
+        if child.nodeType == child.TEXT_NODE:
+            if not collapse_whitespace(child.data):
+                continue
+            return collapse_whitespace(child.data)
+        if child.nodeType == child.CDATA_SECTION_NODE:
+            return child.data
+        return None
+    return None
+
+
+def child_elements(arg_element: minidom.Element, arg_tag: str) -> List[minidom.Element]:
+    """
+    Get the child elements with the given tag
+
+    :param arg_element: Parent element
+    :param arg_tag: Tag of the children
+    :returns: list of child elements in document order
+    """
+    return [
+        child
+        for child in arg_element.childNodes
+        if child.nodeType == child.ELEMENT_NODE and child.tagName == arg_tag
+    ]
+
+
+def get_attribute(arg_element: minidom.Element, arg_name: str) -> Optional[str]:
+    """
+    Get the value of an XML attribute
+
+    :param arg_element: Element containing the attribute
+    :param arg_name: Name of the attribute
+    :returns: value of the attribute, or None if it is not set
+    """
+    if not arg_element.hasAttribute(arg_name):
+        return None
+    return arg_element.getAttribute(arg_name)
+
+
+def get_description(arg_element: minidom.Element) -> Optional[str]:
+    """
+    Get the text of the first <description> child of an element
+
+    :param arg_element: Element containing the description
+    :returns: the description text, or None if there is none
+    """
+    descriptions = child_elements(arg_element, "description")
+    if not descriptions:
+        return None
+    return get_text(descriptions[0])
+
+
+class DescriptionTableWriter:
+    """
+    Generates constexpr tables holding the element descriptions of the spec
+    files, so that the parser can build them without parsing XML
+    """
+
+    def __init__(self) -> None:
+        self.definitions: List[str] = []
+        self.roots: Dict[str, str] = {}
+        self.counter = 0
+
+    def unique_name(self, arg_prefix: str) -> str:
+        """
+        Generates a unique C++ identifier
+
+        :param arg_prefix: Prefix of the identifier
+        :returns: the identifier
+        """
+        self.counter += 1
+        return f"{arg_prefix}{self.counter}"
+
+    def add_array(self, arg_type: str, arg_prefix: str, arg_items: List[str]) -> str:
+        """
+        Adds the definition of a constexpr array
+
+        :param arg_type: C++ type of the array items
+        :param arg_prefix: Prefix of the array name
+        :param arg_items: Initializers of the array items
+        :returns: name of the array, or nullptr if there are no items
+        """
+        if not arg_items:
+            return "nullptr"
+        name = self.unique_name(arg_prefix)
+        res = [f"constexpr {arg_type} {name}[] = {{"]
+        res.append(("," + NEWLINE).join(INDENTATION + item for item in arg_items))
+        res.append("};")
+        self.definitions.append(NEWLINE.join(res))
+        return name
+
+    def element_initializer(self, arg_path: str, arg_element: minidom.Element) -> str:
+        """
+        Generates the initializer of an EmbeddedSdfElement, adding the
+        definitions of its attribute, child element and include arrays
+
+        :param arg_path: Path of the spec file, used in error messages
+        :param arg_element: <element> XML element of the spec file
+        :returns: brace initializer of the EmbeddedSdfElement
+        """
+        name = get_attribute(arg_element, "name")
+        required = get_attribute(arg_element, "required")
+        if name is None or required is None:
+            raise ValueError(
+                f"{arg_path}: <element> is missing the name or required attribute"
+            )
+
+        value_type = get_attribute(arg_element, "type")
+        default_value = get_attribute(arg_element, "default")
+        if value_type is not None and default_value is None:
+            raise ValueError(f"{arg_path}: <element name='{name}'> is missing a default")
+        min_value = get_attribute(arg_element, "min")
+        max_value = get_attribute(arg_element, "max")
+
+        attributes = []
+        for child in child_elements(arg_element, "attribute"):
+            attr_name = get_attribute(child, "name")
+            attr_type = get_attribute(child, "type")
+            attr_default = get_attribute(child, "default")
+            attr_required = get_attribute(child, "required")
+            if None in (attr_name, attr_type, attr_default, attr_required):
+                raise ValueError(
+                    f"{arg_path}: an attribute of <element name='{name}'> is "
+                    "missing its name, type, default or required string"
+                )
+            attr_description = get_description(child)
+            attributes.append(
+                "{"
+                + ", ".join(
+                    [
+                        cpp_string(attr_name),
+                        cpp_string(attr_type),
+                        cpp_string(attr_default),
+                        "true" if attr_required.strip() == "1" else "false",
+                        cpp_string(attr_description or ""),
+                    ]
+                )
+                + "}"
+            )
+
+        copy_children = False
+        elements = []
+        for child in child_elements(arg_element, "element"):
+            if get_attribute(child, "copy_data") in ("true", "1"):
+                copy_children = True
+            else:
+                elements.append(self.element_initializer(arg_path, child))
+
+        includes = []
+        for child in child_elements(arg_element, "include"):
+            filename = get_attribute(child, "filename")
+            if filename is None:
+                raise ValueError(f"{arg_path}: <include> is missing a filename")
+            include_description = None
+            if child_elements(child, "description"):
+                include_description = get_description(child) or ""
+            includes.append(
+                "{"
+                + ", ".join([cpp_string(filename), cpp_string(include_description)])
+                + "}"
+            )
+
+        attributes_name = self.add_array(
+            "EmbeddedSdfAttribute", "kSdfAttributes", attributes
+        )
+        elements_name = self.add_array("EmbeddedSdfElement", "kSdfElements", elements)
+        includes_name = self.add_array("EmbeddedSdfInclude", "kSdfIncludes", includes)
+
+        fields = [
+            cpp_string(name),
+            cpp_string(required),
+            cpp_string(get_attribute(arg_element, "ref")),
+            cpp_string(value_type),
+            cpp_string(default_value),
+            cpp_string(min_value or ""),
+            cpp_string(max_value or ""),
+            cpp_string(get_description(arg_element)),
+            "true" if copy_children else "false",
+            f"{attributes_name}, {len(attributes)}",
+            f"{elements_name}, {len(elements)}",
+            f"{includes_name}, {len(includes)}",
+        ]
+        return "{" + ", ".join(fields) + "}"
+
+    def add_spec_file(self, arg_path: str, arg_file_content: str) -> None:
+        """
+        Adds the description tables of a spec file
+
+        :param arg_path: Foldername and filename of the SDF
+        :param arg_file_content: Content of the provided file
+        """
+        document = minidom.parseString(arg_file_content)
+        root = document.documentElement
+        if root.tagName != "element":
+            raise ValueError(f"{arg_path}: could not find the <element> element")
+        name = self.unique_name("kSdfRoot")
+        initializer = self.element_initializer(arg_path, root)
+        self.definitions.append(f"constexpr EmbeddedSdfElement {name} = {initializer};")
+        self.roots[arg_path] = name
+
+    def tables(self) -> str:
+        """
+        Generates the definitions of all the description tables
+
+        :returns: C++ definitions in an anonymous namespace
+        """
+        res = ["namespace", "{", "// NOLINTBEGIN"]
+        res.extend(self.definitions)
+        res.extend(["// NOLINTEND", "}  // namespace", ""])
+        return NEWLINE.join(res)
+
+    def map_content(self) -> str:
+        """
+        Generates the GetEmbeddedSdfDescriptions function
+
+        :returns: definition of the function
+        """
+        res = inspect.cleandoc(
+            """
+        /////////////////////////////////////////////////
+        const std::map<std::string, const EmbeddedSdfElement *>
+            &GetEmbeddedSdfDescriptions()
+        {
+            static const std::map<std::string, const EmbeddedSdfElement *> result {
+        """
+        )
+        entries = [
+            f'{INDENTATION}{{"{path}", &{name}}}' for path, name in self.roots.items()
+        ]
+        return res + NEWLINE + ("," + NEWLINE).join(entries) + get_map_epilog()
+
+
+def write_output(file_content: str, descriptions: DescriptionTableWriter,
+                 output_filename: str) -> None:
     """
     Print the content of the EmbeddedSdf.cc to a file
     """
     copyright_notice = get_copyright_notice()
     prolog = get_file_header_prolog()
     epilog = get_file_header_epilog()
-    output_content = copyright_notice + prolog + file_content + epilog
+    output_content = (
+        copyright_notice
+        + prolog
+        + descriptions.tables()
+        + get_map_prolog()
+        + file_content
+        + get_map_epilog()
+        + descriptions.map_content()
+        + epilog
+    )
 
     with open(output_filename, "w", encoding="utf8") as output_file:
         output_file.write(output_content)
@@ -153,7 +466,9 @@ def collect_file_locations() -> List[Path]:
     return paths
 
 
-def generate_map_content(paths: List[Path], relative_to: Optional[str] = None) -> str:
+def generate_map_content(paths: List[Path],
+                         descriptions: DescriptionTableWriter,
+                         relative_to: Optional[str] = None) -> str:
     '''
     Generate the EmbeddedSdf.cc content
     '''
@@ -168,6 +483,8 @@ def generate_map_content(paths: List[Path], relative_to: Optional[str] = None) -
             # dir separator is hardcoded to '/' in C++ mapping
             posix_path = PurePosixPath(path)
             content.append(embed_sdf_content(str(posix_path), file_content))
+            if posix_path.suffix == ".sdf":
+                descriptions.add_spec_file(str(posix_path), file_content)
     return ",".join(content)
 
 
@@ -197,8 +514,9 @@ def main(args=None) -> int:
         paths = collect_file_locations()
     else:
         paths = [Path(f) for f in args.input_files]
-    content = generate_map_content(paths, args.sdf_root)
-    write_output(content, args.output_file)
+    descriptions = DescriptionTableWriter()
+    content = generate_map_content(paths, descriptions, args.sdf_root)
+    write_output(content, descriptions, args.output_file)
     return 0
 
 
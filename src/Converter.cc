@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -75,6 +77,111 @@ void UpdatePose(tinyxml2::XMLElement *_elem,
                _modelName, _errors);
   }
 }
+
+/////////////////////////////////////////////////
+// The conversion documents to apply to convert from one version to another,
+// found and parsed once per process.
+struct ConversionPlan
+{
+  // Conversion documents of the version steps, in order.
+  std::vector<std::shared_ptr<tinyxml2::XMLDocument>> steps;
+
+  // Version reached by the steps.
+  std::string version;
+
+  // Error parsing the document of the step after the last one, if any.
+  std::string parseError;
+};
+
+/////////////////////////////////////////////////
+// tinyxml2 processes the names, values and texts of a document the first
+// time they are read, which modifies the document. Read them all, so that
+// the document is only read from then on, and can be used by several
+// threads at once.
+void ProcessAllStrings(const tinyxml2::XMLNode *_node)
+{
+  _node->Value();
+  const tinyxml2::XMLElement *elem = _node->ToElement();
+  if (elem)
+  {
+    for (const auto *attr = elem->FirstAttribute(); attr; attr = attr->Next())
+    {
+      attr->Name();
+      attr->Value();
+    }
+  }
+  for (const auto *child = _node->FirstChild(); child;
+       child = child->NextSibling())
+  {
+    ProcessAllStrings(child);
+  }
+}
+
+/////////////////////////////////////////////////
+// Get the conversion plan from one version to another. Plans are built the
+// first time they are needed, and are never modified afterwards.
+std::shared_ptr<const ConversionPlan> GetConversionPlan(
+    const std::string &_fromVersion, const std::string &_toVersion)
+{
+  static std::mutex mutex;
+  static std::map<std::pair<std::string, std::string>,
+                  std::shared_ptr<const ConversionPlan>> plans;
+  // Documents by the version they convert from, shared by the plans.
+  static std::map<std::string, std::shared_ptr<tinyxml2::XMLDocument>> docs;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = plans.find({_fromVersion, _toVersion});
+  if (it != plans.end())
+    return it->second;
+
+  // The conversion recipes within the embedded files database are named, e.g.,
+  // "1.8/1_7.convert" to upgrade from 1.7 to 1.8.
+  const std::map<std::string, std::string> &embedded = GetEmbeddedSdf();
+
+  auto plan = std::make_shared<ConversionPlan>();
+  plan->version = _fromVersion;
+  while (plan->version != _toVersion)
+  {
+    // Find the (at most one) file named, e.g., ".../1_7.convert".
+    std::string snakeVersion = plan->version;
+    std::replace(snakeVersion.begin(), snakeVersion.end(), '.', '_');
+    const std::string suffix = "/" + snakeVersion + ".convert";
+    std::string nextVersion;
+    const char* convertXml = nullptr;
+    for (const auto& [pathname, data] : embedded)
+    {
+      if (EndsWith(pathname, suffix))
+      {
+        nextVersion = pathname.substr(0, pathname.size() - suffix.size());
+        convertXml = data.c_str();
+        break;
+      }
+    }
+    if (convertXml == nullptr)
+    {
+      break;
+    }
+
+    std::shared_ptr<tinyxml2::XMLDocument> &doc = docs[plan->version];
+    if (!doc)
+    {
+      auto xmlDoc = std::make_shared<tinyxml2::XMLDocument>();
+      xmlDoc->Parse(convertXml);
+      if (xmlDoc->Error())
+      {
+        plan->parseError = xmlDoc->ErrorStr();
+        break;
+      }
+      ProcessAllStrings(xmlDoc.get());
+      doc = xmlDoc;
+    }
+    plan->steps.push_back(doc);
+    plan->version = nextVersion;
+  }
+
+  plans[{_fromVersion, _toVersion}] = plan;
+  return plan;
+}
 }
 
 /////////////////////////////////////////////////
@@ -121,49 +228,27 @@ bool Converter::Convert(sdf::Errors &_errors,
 
   elem->SetAttribute("version", _toVersion.c_str());
 
-  // The conversion recipes within the embedded files database are named, e.g.,
-  // "1.8/1_7.convert" to upgrade from 1.7 to 1.8.
-  const std::map<std::string, std::string> &embedded = GetEmbeddedSdf();
-
   // Apply the conversions one at a time until we reach the desired _toVersion.
-  std::string curVersion = origVersion;
-  while (curVersion != _toVersion)
+  // The documents of the conversions are shared by all conversions, and
+  // are only read.
+  std::shared_ptr<const ConversionPlan> plan =
+      GetConversionPlan(origVersion, _toVersion);
+  for (const auto &step : plan->steps)
   {
-    // Find the (at most one) file named, e.g., ".../1_7.convert".
-    std::string snakeVersion = curVersion;
-    std::replace(snakeVersion.begin(), snakeVersion.end(), '.', '_');
-    const std::string suffix = "/" + snakeVersion + ".convert";
-    const char* convertXml = nullptr;
-    for (const auto& [pathname, data] : embedded)
-    {
-      if (EndsWith(pathname, suffix))
-      {
-        curVersion = pathname.substr(0, pathname.size() - suffix.size());
-        convertXml = data.c_str();
-        break;
-      }
-    }
-    if (convertXml == nullptr)
-    {
-      break;
-    }
+    ConvertImpl(elem, step->FirstChildElement("convert"), _config, _errors);
+  }
 
-    // Parse and apply the conversion XML.
-    tinyxml2::XMLDocument xmlDoc;
-    xmlDoc.Parse(convertXml);
-    if (xmlDoc.Error())
-    {
-      std::stringstream ss;
-      ss << "Error parsing XML from string: "
-         << xmlDoc.ErrorStr();
-      _errors.push_back({ErrorCode::CONVERSION_ERROR, ss.str()});
-      return false;
-    }
-    ConvertImpl(elem, xmlDoc.FirstChildElement("convert"), _config, _errors);
+  if (!plan->parseError.empty())
+  {
+    std::stringstream ss;
+    ss << "Error parsing XML from string: "
+       << plan->parseError;
+    _errors.push_back({ErrorCode::CONVERSION_ERROR, ss.str()});
+    return false;
   }
 
   // Check that we actually converted to the desired final version.
-  if (curVersion != _toVersion)
+  if (plan->version != _toVersion)
   {
     std::stringstream ss;
     ss << "Unable to convert from SDF version "
@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 #include <array>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 #include "sdf/Exception.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/ParserConfig.hh"
@@ -3725,3 +3728,75 @@ TEST(Converter, World_17_to_18)
   EXPECT_STREQ(convertedElem->Attribute("relative_to"), "__model__");
   EXPECT_STREQ(convertedElem->NextSiblingElement()->Name(), "geometry");
 }
+
+/////////////////////////////////////////////////
+/// Convert a document through every version from many threads at once.
+/// The conversion documents are parsed once and shared by all threads, so
+/// every thread must get the same result as a single conversion.
+TEST(Converter, ConcurrentConversions)
+{
+  const std::string xmlString = R"(
+<sdf version="1.4">
+  <world name="default">
+    <model name="model">
+      <pose>1 2 3 0 0 0</pose>
+      <link name="link">
+        <sensor name="imu" type="imu">
+          <imu><noise><type>gaussian</type></noise></imu>
+        </sensor>
+      </link>
+      <joint name="joint" type="revolute">
+        <parent>world</parent>
+        <child>link</child>
+        <axis>
+          <xyz>0 0 1</xyz>
+          <use_parent_model_frame>1</use_parent_model_frame>
+        </axis>
+      </joint>
+    </model>
+  </world>
+</sdf>)";
+
+  auto convert = [&xmlString](sdf::Errors &_errors)
+  {
+    tinyxml2::XMLDocument xmlDoc;
+    xmlDoc.Parse(xmlString.c_str());
+    sdf::ParserConfig config;
+    if (!sdf::Converter::Convert(_errors, &xmlDoc, SDF_PROTOCOL_VERSION,
+                                 config, true))
+    {
+      return std::string();
+    }
+    tinyxml2::XMLPrinter printer;
+    xmlDoc.Print(&printer);
+    return std::string(printer.CStr());
+  };
+
+  sdf::Errors errors;
+  const std::string expected = convert(errors);
+  ASSERT_FALSE(expected.empty()) << errors;
+  EXPECT_NE(std::string::npos,
+            expected.find("<sdf version=\"" SDF_PROTOCOL_VERSION "\">"));
+
+  constexpr int kThreadCount = 8;
+  std::array<std::string, kThreadCount> results;
+  std::array<std::size_t, kThreadCount> errorCounts;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    threads.emplace_back([&, t]()
+    {
+      sdf::Errors threadErrors;
+      results[t] = convert(threadErrors);
+      errorCounts[t] = threadErrors.size();
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    EXPECT_EQ(expected, results[t]) << "thread " << t;
+    EXPECT_EQ(errors.size(), errorCounts[t]) << "thread " << t;
+  }
+}
@@ -16,12 +16,15 @@
  */
 
 #include <algorithm>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "sdf/Assert.hh"
 #include "sdf/Element.hh"
 #include "sdf/Filesystem.hh"
+#include "ElementArena.hh"
 #include "Utils.hh"
 
 using namespace sdf;
@@ -31,8 +34,9 @@ Element::Element()
   : dataPtr(new ElementPrivate)
 {
   this->dataPtr->copyChildren = false;
-  this->dataPtr->referenceSDF = "";
   this->dataPtr->explicitlySetInFile = true;
+  this->dataPtr->siblingIndex = 0;
+  this->dataPtr->namedSiblingIndex = 0;
 }
 
 /////////////////////////////////////////////////
@@ -52,22 +56,31 @@ void Element::SetParent(const ElementPtr _parent)
   this->dataPtr->parent = _parent;
 
   // If this element doesn't have a path, get it from the parent
-  if (nullptr != _parent && (this->FilePath().empty() ||
-      this->FilePath() == std::string(kSdfStringSource)))
+  if (nullptr != _parent && (this->dataPtr->path.Empty() ||
+      this->dataPtr->path == std::string(kSdfStringSource)))
   {
-    this->SetFilePath(_parent->FilePath());
+    this->dataPtr->path = _parent->dataPtr->path;
   }
 
   // If this element doesn't have an original version, get it from the parent
-  if (nullptr != _parent && this->OriginalVersion().empty())
+  if (nullptr != _parent && this->dataPtr->originalVersion.Empty())
   {
-    this->SetOriginalVersion(_parent->OriginalVersion());
+    this->dataPtr->originalVersion = _parent->dataPtr->originalVersion;
   }
 }
 
 /////////////////////////////////////////////////
 void Element::SetName(const std::string &_name)
 {
+  if (this->dataPtr->name == _name)
+    return;
+
+  // If this element was already inserted into its parent, it is moved to
+  // its new name in the name index of the parent.
+  auto parent = this->dataPtr->parent.lock();
+  if (parent)
+    parent->dataPtr->RenameElement(this, _name);
+
   this->dataPtr->name = _name;
 }
 
@@ -179,9 +192,9 @@ void Element::AddValue(const std::string &_type,
                        const std::string &_description)
 {
   this->dataPtr->value =
-      std::make_shared<Param>(this->dataPtr->name, _type, _defaultValue,
-                              _required, _minValue, _maxValue, _errors,
-                              _description);
+      makeArenaShared<Param>(this->dataPtr->name, _type, _defaultValue,
+                             _required, _minValue, _maxValue, _errors,
+                             _description);
   SDF_ASSERT(this->dataPtr->value->SetParentElement(shared_from_this()),
       "Cannot set parent Element of value to itself.");
 }
@@ -194,7 +207,7 @@ ParamPtr Element::CreateParam(const std::string &_key,
                               sdf::Errors &_errors,
                               const std::string &_description)
 {
-  ParamPtr param = std::make_shared<Param>(
+  ParamPtr param = makeArenaShared<Param>(
       _key, _type, _defaultValue, _required, _errors, _description);
   SDF_ASSERT(param->SetParentElement(shared_from_this()),
       "Cannot set parent Element of created Param to itself.");
@@ -239,7 +252,7 @@ ElementPtr Element::Clone() const
 /////////////////////////////////////////////////
 ElementPtr Element::Clone(sdf::Errors &_errors) const
 {
-  ElementPtr clone(new Element);
+  ElementPtr clone = makeArenaShared<Element>();
   clone->dataPtr->description = this->dataPtr->description;
   clone->dataPtr->name = this->dataPtr->name;
   clone->dataPtr->required = this->dataPtr->required;
@@ -262,18 +275,17 @@ ElementPtr Element::Clone(sdf::Errors &_errors) const
     clone->dataPtr->attributes.push_back(clonedAttribute);
   }
 
-  ElementPtr_V::const_iterator eiter;
-  for (eiter = this->dataPtr->elementDescriptions.begin();
-      eiter != this->dataPtr->elementDescriptions.end(); ++eiter)
-  {
-    clone->dataPtr->elementDescriptions.push_back((*eiter)->Clone(_errors));
-  }
+  // Element descriptions are immutable, so they are shared with the clone
+  // instead of being copied.
+  clone->dataPtr->ShareElementDescriptions(*this->dataPtr);
 
+  ElementPtr_V::const_iterator eiter;
   for (eiter = this->dataPtr->elements.begin();
        eiter != this->dataPtr->elements.end(); ++eiter)
   {
-    clone->dataPtr->elements.push_back((*eiter)->Clone(_errors));
-    clone->dataPtr->elements.back()->SetParent(clone);
+    ElementPtr elem = (*eiter)->Clone(_errors);
+    elem->SetParent(clone);
+    clone->dataPtr->AppendElement(elem);
   }
 
   if (this->dataPtr->value)
@@ -303,14 +315,13 @@ void Element::Copy(const ElementPtr _elem)
 /////////////////////////////////////////////////
 void Element::Copy(const ElementPtr _elem, sdf::Errors &_errors)
 {
-
-  this->dataPtr->name = _elem->GetName();
-  this->dataPtr->description = _elem->GetDescription();
-  this->dataPtr->required = _elem->GetRequired();
+  this->SetName(_elem->GetName());
+  this->dataPtr->description = _elem->dataPtr->description;
+  this->dataPtr->required = _elem->dataPtr->required;
   this->dataPtr->copyChildren = _elem->GetCopyChildren();
-  this->dataPtr->referenceSDF = _elem->ReferenceSDF();
-  this->dataPtr->originalVersion = _elem->OriginalVersion();
-  this->dataPtr->path = _elem->FilePath();
+  this->dataPtr->referenceSDF = _elem->dataPtr->referenceSDF;
+  this->dataPtr->originalVersion = _elem->dataPtr->originalVersion;
+  this->dataPtr->path = _elem->dataPtr->path;
   this->dataPtr->lineNumber = _elem->LineNumber();
   this->dataPtr->xmlPath = _elem->XmlPath();
   this->dataPtr->explicitlySetInFile = _elem->GetExplicitlySetInFile();
@@ -342,15 +353,9 @@ void Element::Copy(const ElementPtr _elem, sdf::Errors &_errors)
         "Cannot set parent Element of copied value Param to itself.");
   }
 
-  this->dataPtr->elementDescriptions.clear();
-  for (ElementPtr_V::const_iterator iter =
-       _elem->dataPtr->elementDescriptions.begin();
-       iter != _elem->dataPtr->elementDescriptions.end(); ++iter)
-  {
-    this->dataPtr->elementDescriptions.push_back((*iter)->Clone(_errors));
-  }
+  this->dataPtr->ShareElementDescriptions(*_elem->dataPtr);
 
-  this->dataPtr->elements.clear();
+  this->dataPtr->ClearElements();
   for (ElementPtr_V::iterator iter = _elem->dataPtr->elements.begin();
        iter != _elem->dataPtr->elements.end(); ++iter)
   {
@@ -358,7 +363,7 @@ void Element::Copy(const ElementPtr _elem, sdf::Errors &_errors)
     elem = (*iter)->Clone(_errors);
     elem->Copy(*iter, _errors);
     elem->SetParent(shared_from_this());
-    this->dataPtr->elements.push_back(elem);
+    this->dataPtr->AppendElement(elem);
   }
 
   if (_elem->dataPtr->includeElement)
@@ -478,7 +483,7 @@ void Element::PrintDocRightPane(std::string &_html, int _spacing,
   stream << "<div style='background-color: #ffffff'>\n";
 
   stream << "<font style='font-weight:bold'>Description: </font>";
-  if (!this->dataPtr->description.empty())
+  if (!this->dataPtr->description.Empty())
   {
     stream << this->dataPtr->description << "<br>\n";
   }
@@ -684,6 +689,193 @@ void ElementPrivate::PrintAttributes(sdf::Errors &_errors,
   }
 }
 
+/////////////////////////////////////////////////
+/// \brief Find the position of an element in a list of siblings. The
+/// position hint is checked first, so this is constant time unless the hint
+/// is stale.
+/// \param[in] _siblings List of sibling elements.
+/// \param[in] _elem Element to look for.
+/// \param[in] _hint Expected position of the element.
+/// \return Position of the element, or the size of the list if the element
+/// is not in it.
+static std::size_t findSibling(const ElementPtr_V &_siblings,
+                               const Element *_elem, std::size_t _hint)
+{
+  if (_hint < _siblings.size() && _siblings[_hint].get() == _elem)
+    return _hint;
+
+  auto iter = std::find_if(_siblings.begin(), _siblings.end(),
+      [_elem](const ElementPtr &_sibling)
+      {
+        return _sibling.get() == _elem;
+      });
+  return iter - _siblings.begin();
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::AppendElement(ElementPtr _elem)
+{
+  _elem->dataPtr->siblingIndex = this->elements.size();
+  this->elements.push_back(_elem);
+
+  if (this->elementIndex)
+  {
+    ElementPtr_V &named = (*this->elementIndex)[_elem->GetName()];
+    _elem->dataPtr->namedSiblingIndex = named.size();
+    named.push_back(_elem);
+  }
+  else if (this->elements.size() >= kElementIndexThreshold)
+  {
+    this->ReindexElements();
+  }
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::EraseElement(ElementPtr_V::iterator _iter)
+{
+  if (this->elementIndex)
+  {
+    auto indexIter = this->elementIndex->find((*_iter)->GetName());
+    if (indexIter != this->elementIndex->end())
+    {
+      ElementPtr_V &named = indexIter->second;
+      const std::size_t pos = findSibling(named, _iter->get(),
+          (*_iter)->dataPtr->namedSiblingIndex);
+      if (pos < named.size())
+      {
+        named.erase(named.begin() + pos);
+        for (std::size_t i = pos; i < named.size(); ++i)
+          named[i]->dataPtr->namedSiblingIndex = i;
+      }
+      if (named.empty())
+        this->elementIndex->erase(indexIter);
+    }
+  }
+
+  _iter = this->elements.erase(_iter);
+  for (; _iter != this->elements.end(); ++_iter)
+    (*_iter)->dataPtr->siblingIndex = _iter - this->elements.begin();
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::ClearElements()
+{
+  this->elements.clear();
+  this->elementIndex.reset();
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::ReindexElements()
+{
+  this->elementIndex =
+      std::make_unique<std::unordered_map<std::string, ElementPtr_V>>();
+  for (std::size_t i = 0; i < this->elements.size(); ++i)
+  {
+    const ElementPtr &elem = this->elements[i];
+    ElementPtr_V &named = (*this->elementIndex)[elem->GetName()];
+    elem->dataPtr->siblingIndex = i;
+    elem->dataPtr->namedSiblingIndex = named.size();
+    named.push_back(elem);
+  }
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::RenameElement(const Element *_elem,
+                                   const std::string &_name)
+{
+  if (!this->elementIndex)
+    return;
+
+  auto oldIter = this->elementIndex->find(_elem->GetName());
+  if (oldIter == this->elementIndex->end())
+    return;
+
+  ElementPtr_V &oldNamed = oldIter->second;
+  const std::size_t oldPos =
+      findSibling(oldNamed, _elem, _elem->dataPtr->namedSiblingIndex);
+  if (oldPos == oldNamed.size())
+    return;
+
+  ElementPtr elem = oldNamed[oldPos];
+  oldNamed.erase(oldNamed.begin() + oldPos);
+  for (std::size_t i = oldPos; i < oldNamed.size(); ++i)
+    oldNamed[i]->dataPtr->namedSiblingIndex = i;
+  if (oldNamed.empty())
+    this->elementIndex->erase(oldIter);
+
+  // The children with the new name are kept in the order of `elements`.
+  ElementPtr_V &named = (*this->elementIndex)[_name];
+  auto iter = std::lower_bound(named.begin(), named.end(),
+      elem->dataPtr->siblingIndex,
+      [](const ElementPtr &_named, std::size_t _siblingIndex)
+      {
+        return _named->dataPtr->siblingIndex < _siblingIndex;
+      });
+  iter = named.insert(iter, elem);
+  for (std::size_t i = iter - named.begin(); i < named.size(); ++i)
+    named[i]->dataPtr->namedSiblingIndex = i;
+}
+
+/////////////////////////////////////////////////
+ElementPtr ElementPrivate::FindElement(const std::string &_name) const
+{
+  if (!this->elementIndex)
+  {
+    for (const ElementPtr &elem : this->elements)
+    {
+      if (elem->GetName() == _name)
+        return elem;
+    }
+    return ElementPtr();
+  }
+
+  auto iter = this->elementIndex->find(_name);
+  if (iter == this->elementIndex->end())
+    return ElementPtr();
+  return iter->second.front();
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::ShareElementDescriptions(const ElementPrivate &_other)
+{
+  this->elementDescriptions = _other.elementDescriptions;
+  this->elementDescriptionIndex = _other.elementDescriptionIndex;
+}
+
+/////////////////////////////////////////////////
+void ElementPrivate::AppendElementDescription(ElementPtr _elem)
+{
+  // The index is extended in place unless it is shared with other elements,
+  // in which case it is copied first.
+  if (!this->elementDescriptionIndex)
+  {
+    this->elementDescriptionIndex =
+        std::make_shared<std::unordered_map<std::string, ElementPtr>>();
+  }
+  else if (this->elementDescriptionIndex.use_count() > 1)
+  {
+    this->elementDescriptionIndex =
+        std::make_shared<std::unordered_map<std::string, ElementPtr>>(
+            *this->elementDescriptionIndex);
+  }
+  this->elementDescriptionIndex->emplace(_elem->GetName(), _elem);
+
+  this->elementDescriptions.push_back(_elem);
+}
+
+/////////////////////////////////////////////////
+ElementPtr ElementPrivate::FindElementDescription(
+    const std::string &_name) const
+{
+  if (!this->elementDescriptionIndex)
+    return ElementPtr();
+
+  auto iter = this->elementDescriptionIndex->find(_name);
+  if (iter == this->elementDescriptionIndex->end())
+    return ElementPtr();
+  return iter->second;
+}
+
 /////////////////////////////////////////////////
 void Element::PrintValues(std::string _prefix,
                           const PrintConfig &_config) const
@@ -889,9 +1081,9 @@ size_t Element::GetElementDescriptionCount() const
 }
 
 /////////////////////////////////////////////////
-ElementPtr Element::GetElementDescription(unsigned int _index) const
+ElementConstPtr Element::GetElementDescription(unsigned int _index) const
 {
-  ElementPtr result;
+  ElementConstPtr result;
   if (_index < this->dataPtr->elementDescriptions.size())
   {
     result = this->dataPtr->elementDescriptions[_index];
@@ -900,19 +1092,10 @@ ElementPtr Element::GetElementDescription(unsigned int _index) const
 }
 
 /////////////////////////////////////////////////
-ElementPtr Element::GetElementDescription(const std::string &_key) const
+ElementConstPtr Element::GetElementDescription(
+    const std::string &_key) const
 {
-  ElementPtr_V::const_iterator iter;
-  for (iter = this->dataPtr->elementDescriptions.begin();
-       iter != this->dataPtr->elementDescriptions.end(); ++iter)
-  {
-    if ((*iter)->GetName() == _key)
-    {
-      return (*iter);
-    }
-  }
-
-  return ElementPtr();
+  return this->dataPtr->FindElementDescription(_key);
 }
 
 /////////////////////////////////////////////////
@@ -928,19 +1111,28 @@ bool Element::HasElement(const std::string &_name) const
 }
 
 /////////////////////////////////////////////////
-ElementPtr Element::GetElementImpl(const std::string &_name) const
+size_t Element::GetElementCount(const std::string &_name) const
 {
-  ElementPtr_V::const_iterator iter;
-  for (iter = this->dataPtr->elements.begin();
-       iter != this->dataPtr->elements.end(); ++iter)
+  if (!this->dataPtr->elementIndex)
   {
-    if ((*iter)->GetName() == _name)
-    {
-      return (*iter);
-    }
+    return static_cast<size_t>(std::count_if(
+        this->dataPtr->elements.begin(), this->dataPtr->elements.end(),
+        [&_name](const ElementPtr &_elem)
+        {
+          return _elem->GetName() == _name;
+        }));
   }
 
-  return ElementPtr();
+  auto iter = this->dataPtr->elementIndex->find(_name);
+  if (iter == this->dataPtr->elementIndex->end())
+    return 0;
+  return iter->second.size();
+}
+
+/////////////////////////////////////////////////
+ElementPtr Element::GetElementImpl(const std::string &_name) const
+{
+  return this->dataPtr->FindElement(_name);
 }
 
 /////////////////////////////////////////////////
@@ -960,36 +1152,33 @@ ElementPtr Element::GetFirstElement() const
 ElementPtr Element::GetNextElement(const std::string &_name) const
 {
   auto parent = this->dataPtr->parent.lock();
-  if (parent)
-  {
-    ElementPtr_V::const_iterator iter;
-    iter = std::find(parent->dataPtr->elements.begin(),
-        parent->dataPtr->elements.end(), shared_from_this());
+  if (!parent)
+    return ElementPtr();
 
-    if (iter == parent->dataPtr->elements.end())
-    {
-      return ElementPtr();
-    }
+  const ElementPrivate &siblings = *parent->dataPtr;
 
-    ++iter;
-    if (iter == parent->dataPtr->elements.end())
-    {
+  // Siblings with the same name are adjacent in the name index
+  if (siblings.elementIndex && !_name.empty() &&
+      _name == this->dataPtr->name)
+  {
+    auto indexIter = siblings.elementIndex->find(_name);
+    if (indexIter == siblings.elementIndex->end())
       return ElementPtr();
-    }
-    else if (_name.empty())
-    {
-      return *(iter);
-    }
-    else
-    {
-      for (; iter != parent->dataPtr->elements.end(); ++iter)
-      {
-        if ((*iter)->GetName() == _name)
-        {
-          return (*iter);
-        }
-      }
-    }
+
+    const ElementPtr_V &named = indexIter->second;
+    std::size_t pos =
+        findSibling(named, this, this->dataPtr->namedSiblingIndex);
+    if (pos + 1 < named.size())
+      return named[pos + 1];
+    return ElementPtr();
+  }
+
+  std::size_t pos =
+      findSibling(siblings.elements, this, this->dataPtr->siblingIndex);
+  for (++pos; pos < siblings.elements.size(); ++pos)
+  {
+    if (_name.empty() || siblings.elements[pos]->GetName() == _name)
+      return siblings.elements[pos];
   }
 
   return ElementPtr();
@@ -1159,7 +1348,7 @@ ElementConstPtr Element::FindElement(const std::string &_name) const
 /////////////////////////////////////////////////
 void Element::InsertElement(ElementPtr _elem)
 {
-  this->dataPtr->elements.push_back(_elem);
+  this->dataPtr->AppendElement(_elem);
 }
 
 /////////////////////////////////////////////////
@@ -1167,13 +1356,13 @@ void Element::InsertElement(ElementPtr _elem,  bool _setParentToSelf)
 {
   if (_setParentToSelf)
     _elem->SetParent(shared_from_this());
-  this->dataPtr->elements.push_back(_elem);
+  this->dataPtr->AppendElement(_elem);
 }
 
 /////////////////////////////////////////////////
 bool Element::HasElementDescription(const std::string &_name) const
 {
-  return this->GetElementDescription(_name) != ElementPtr();
+  return this->GetElementDescription(_name) != nullptr;
 }
 
 /////////////////////////////////////////////////
@@ -1191,39 +1380,32 @@ ElementPtr Element::AddElement(const std::string &_name, sdf::Errors &_errors)
   // if this element is a reference sdf and does not have any element
   // descriptions then get them from its parent
   auto parent = this->dataPtr->parent.lock();
-  if (!this->dataPtr->referenceSDF.empty() &&
+  if (!this->dataPtr->referenceSDF.Empty() &&
       this->dataPtr->elementDescriptions.empty() && parent &&
       parent->GetName() == this->dataPtr->name)
   {
-    for (unsigned int i = 0; i < parent->GetElementDescriptionCount(); ++i)
-    {
-      this->dataPtr->elementDescriptions.push_back(
-        parent->GetElementDescription(i)->Clone(_errors));
-    }
+    this->dataPtr->ShareElementDescriptions(*parent->dataPtr);
   }
 
-  ElementPtr_V::const_iterator iter, iter2;
-  for (iter = this->dataPtr->elementDescriptions.begin();
-      iter != this->dataPtr->elementDescriptions.end(); ++iter)
+  ElementPtr desc = this->dataPtr->FindElementDescription(_name);
+  if (desc)
   {
-    if ((*iter)->dataPtr->name == _name)
-    {
-      ElementPtr elem = (*iter)->Clone(_errors);
-      elem->SetParent(shared_from_this());
-      this->dataPtr->elements.push_back(elem);
+    ElementPtr elem = desc->Clone(_errors);
+    elem->SetParent(shared_from_this());
+    this->dataPtr->AppendElement(elem);
 
-      // Add all child elements.
-      for (iter2 = elem->dataPtr->elementDescriptions.begin();
-           iter2 != elem->dataPtr->elementDescriptions.end(); ++iter2)
+    // Add all child elements.
+    ElementPtr_V::const_iterator iter;
+    for (iter = elem->dataPtr->elementDescriptions.begin();
+         iter != elem->dataPtr->elementDescriptions.end(); ++iter)
+    {
+      // Add only required child element
+      if ((*iter)->GetRequired() == "1")
       {
-        // Add only required child element
-        if ((*iter2)->GetRequired() == "1")
-        {
-          elem->AddElement((*iter2)->dataPtr->name, _errors);
-        }
+        elem->AddElement((*iter)->dataPtr->name, _errors);
       }
-      return this->dataPtr->elements.back();
     }
+    return elem;
   }
 
   _errors.push_back({ErrorCode::ELEMENT_ERROR,
@@ -1235,8 +1417,8 @@ ElementPtr Element::AddElement(const std::string &_name, sdf::Errors &_errors)
 void Element::Clear()
 {
   this->ClearElements();
-  this->dataPtr->originalVersion.clear();
-  this->dataPtr->path.clear();
+  this->dataPtr->originalVersion.Clear();
+  this->dataPtr->path.Clear();
   this->dataPtr->lineNumber = std::nullopt;
   this->dataPtr->xmlPath.clear();
 }
@@ -1250,7 +1432,7 @@ void Element::ClearElements()
     (*iter)->ClearElements();
   }
 
-  this->dataPtr->elements.clear();
+  this->dataPtr->ClearElements();
 }
 
 
@@ -1296,17 +1478,11 @@ void Element::Reset()
     (*iter).reset();
   }
 
-  for (ElementPtr_V::iterator iter = this->dataPtr->elementDescriptions.begin();
-      iter != this->dataPtr->elementDescriptions.end(); ++iter)
-  {
-    if (*iter)
-    {
-      (*iter)->Reset();
-    }
-    (*iter).reset();
-  }
-  this->dataPtr->elements.clear();
+  // Element descriptions may be shared with other elements, so they are
+  // released but not reset.
+  this->dataPtr->ClearElements();
   this->dataPtr->elementDescriptions.clear();
+  this->dataPtr->elementDescriptionIndex.reset();
 
   this->dataPtr->value.reset();
 
@@ -1316,7 +1492,7 @@ void Element::Reset()
 /////////////////////////////////////////////////
 void Element::AddElementDescription(ElementPtr _elem)
 {
-  this->dataPtr->elementDescriptions.push_back(_elem);
+  this->dataPtr->AppendElementDescription(_elem);
 }
 
 /////////////////////////////////////////////////
@@ -1403,7 +1579,7 @@ void Element::RemoveFromParent()
 
     if (iter != parent->dataPtr->elements.end())
     {
-      parent->dataPtr->elements.erase(iter);
+      parent->dataPtr->EraseElement(iter);
       parent.reset();
     }
   }
@@ -1429,7 +1605,7 @@ void Element::RemoveChild(ElementPtr _child, sdf::Errors &)
   if (iter != this->dataPtr->elements.end())
   {
     _child->SetParent(ElementPtr());
-    this->dataPtr->elements.erase(iter);
+    this->dataPtr->EraseElement(iter);
   }
 }
 
@@ -1459,7 +1635,7 @@ std::any Element::GetAny(sdf::Errors &_errors, const std::string &_key) const
     ParamPtr param = this->GetAttribute(_key);
     if (param)
     {
-      if (!this->GetAttribute(_key)->GetAny(result, _errors))
+      if (!param->GetAny(result, _errors))
       {
         _errors.push_back({ErrorCode::ELEMENT_ERROR,
             "Couldn't get attribute [" + _key + "] as std::any\n"});
@@ -1474,10 +1650,10 @@ std::any Element::GetAny(sdf::Errors &_errors, const std::string &_key) const
       }
       else
       {
-        tmp = this->GetElementDescription(_key);
-        if (tmp != ElementPtr())
+        ElementConstPtr desc = this->GetElementDescription(_key);
+        if (desc != nullptr)
         {
-          result = tmp->GetAny(_errors);
+          result = desc->GetAny(_errors);
         }
         else
         {
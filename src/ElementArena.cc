@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "ElementArena.hh"
+
+using namespace sdf;
+
+/////////////////////////////////////////////////
+/// \brief Arena used by the parser on the calling thread.
+static std::shared_ptr<ElementArena> &activeArena()
+{
+  static thread_local std::shared_ptr<ElementArena> arena;
+  return arena;
+}
+
+/////////////////////////////////////////////////
+ElementArena::ElementArena(std::size_t _blockSize)
+  : blockSize(_blockSize)
+{
+}
+
+/////////////////////////////////////////////////
+void *ElementArena::Allocate(std::size_t _size, std::size_t _alignment)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+
+  void *result = std::align(_alignment, _size, this->next, this->available);
+  if (result)
+  {
+    this->next = static_cast<unsigned char *>(result) + _size;
+    this->available -= _size;
+    return result;
+  }
+
+  // Large objects get a block of their own, so the rest of the current block
+  // stays in use.
+  const std::size_t size = _size + _alignment;
+  if (size > this->blockSize / 4)
+  {
+    this->blocks.emplace_back(new unsigned char[size]);
+    void *ptr = this->blocks.back().get();
+    std::size_t space = size;
+    return std::align(_alignment, _size, ptr, space);
+  }
+
+  this->blocks.emplace_back(new unsigned char[this->blockSize]);
+  this->next = this->blocks.back().get();
+  this->available = this->blockSize;
+
+  result = std::align(_alignment, _size, this->next, this->available);
+  this->next = static_cast<unsigned char *>(result) + _size;
+  this->available -= _size;
+  return result;
+}
+
+/////////////////////////////////////////////////
+std::size_t ElementArena::BlockCount() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->blocks.size();
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<ElementArena> ElementArena::Active()
+{
+  return activeArena();
+}
+
+/////////////////////////////////////////////////
+ElementArenaScope::ElementArenaScope(const ParserConfig &_config)
+  : previous(activeArena())
+{
+  if (_config.ArenaAllocation() && !this->previous)
+    activeArena() = std::make_shared<ElementArena>();
+}
+
+/////////////////////////////////////////////////
+ElementArenaScope::ElementArenaScope(std::shared_ptr<ElementArena> _arena)
+  : previous(activeArena())
+{
+  activeArena() = std::move(_arena);
+}
+
+/////////////////////////////////////////////////
+ElementArenaScope::~ElementArenaScope()
+{
+  activeArena() = std::move(this->previous);
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef SDF_ELEMENTARENA_HH_
+#define SDF_ELEMENTARENA_HH_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "sdf/ParserConfig.hh"
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Memory arena for the elements and params of a parsed document.
+  ///
+  /// Nodes are carved out of large blocks and are never freed one by one.
+  /// Every node allocated from the arena keeps it alive, so all the blocks
+  /// are released at once when the last node of the document is destroyed.
+  ///
+  /// Only the Element and Param objects and their shared_ptr control blocks
+  /// are allocated from the arena, through makeArenaShared. Their
+  /// ElementPrivate and ParamPrivate data are created with new by their
+  /// constructors, and stay on the heap: allocating them from the arena
+  /// would need a deleter in the unique_ptr of Element and Param, which
+  /// changes their ABI.
+  ///
+  /// The active arena is per thread. Threads that parse part of a document,
+  /// such as the threads that read included files ahead of time, activate
+  /// the arena of the thread that started the parse with ElementArenaScope.
+  class ElementArena
+  {
+    /// \brief Constructor.
+    /// \param[in] _blockSize Size in bytes of the blocks to allocate.
+    public: explicit ElementArena(std::size_t _blockSize = kDefaultBlockSize);
+
+    /// \brief Allocate memory from the arena.
+    /// \param[in] _size Number of bytes to allocate.
+    /// \param[in] _alignment Alignment of the memory.
+    /// \return Pointer to the allocated memory.
+    public: void *Allocate(std::size_t _size, std::size_t _alignment);
+
+    /// \brief Get the number of blocks allocated by the arena.
+    /// \return Number of blocks.
+    public: std::size_t BlockCount() const;
+
+    /// \brief Get the arena used by the parser on the calling thread.
+    /// \return The active arena, or nullptr if nodes are allocated on the
+    /// heap.
+    public: static std::shared_ptr<ElementArena> Active();
+
+    /// \brief Default size in bytes of the blocks.
+    public: static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+    /// \brief Size in bytes of the blocks.
+    private: std::size_t blockSize;
+
+    /// \brief Blocks of memory owned by the arena.
+    private: std::vector<std::unique_ptr<unsigned char[]>> blocks;
+
+    /// \brief Next free byte of the current block.
+    private: void *next = nullptr;
+
+    /// \brief Number of free bytes left in the current block.
+    private: std::size_t available = 0;
+
+    /// \brief Mutex to allow allocating from several threads.
+    private: mutable std::mutex mutex;
+  };
+
+  /// \internal
+  /// \brief Standard allocator that allocates from an ElementArena. It owns
+  /// a reference to the arena, so the arena outlives every shared pointer
+  /// created with std::allocate_shared and this allocator.
+  template <typename T>
+  class ElementArenaAllocator
+  {
+    /// \brief Type of the allocated objects.
+    public: using value_type = T;
+
+    /// \brief Constructor.
+    /// \param[in] _arena Arena to allocate from.
+    public: explicit ElementArenaAllocator(
+                std::shared_ptr<ElementArena> _arena)
+      : arena(std::move(_arena))
+    {
+    }
+
+    /// \brief Converting constructor used to rebind the allocator.
+    /// \param[in] _other Allocator to copy the arena from.
+    public: template <typename U>
+    ElementArenaAllocator(const ElementArenaAllocator<U> &_other)
+      : arena(_other.arena)
+    {
+    }
+
+    /// \brief Allocate memory for _n objects.
+    /// \param[in] _n Number of objects.
+    /// \return Pointer to the allocated memory.
+    public: T *allocate(std::size_t _n)
+    {
+      return static_cast<T *>(
+          this->arena->Allocate(sizeof(T) * _n, alignof(T)));
+    }
+
+    /// \brief Memory is released with the arena, so this does nothing.
+    public: void deallocate(T *, std::size_t)
+    {
+    }
+
+    /// \brief Arena to allocate from.
+    public: std::shared_ptr<ElementArena> arena;
+  };
+
+  /// \brief Allocators are equal if they use the same arena.
+  template <typename T, typename U>
+  bool operator==(const ElementArenaAllocator<T> &_a,
+                  const ElementArenaAllocator<U> &_b)
+  {
+    return _a.arena == _b.arena;
+  }
+
+  /// \brief Allocators are different if they use different arenas.
+  template <typename T, typename U>
+  bool operator!=(const ElementArenaAllocator<T> &_a,
+                  const ElementArenaAllocator<U> &_b)
+  {
+    return !(_a == _b);
+  }
+
+  /// \internal
+  /// \brief Activate an arena for the calling thread while the parser reads a
+  /// document. Scopes can be nested, e.g. while reading included files, in
+  /// which case all nodes come from the arena of the outermost scope. The
+  /// previously active arena is restored when the scope ends.
+  class ElementArenaScope
+  {
+    /// \brief Constructor. Creates and activates a new arena if the
+    /// configuration enables arena allocation and no arena is active yet.
+    /// \param[in] _config Parser configuration.
+    public: explicit ElementArenaScope(const ParserConfig &_config);
+
+    /// \brief Constructor. Activates the given arena. Passing nullptr
+    /// allocates nodes on the heap within the scope, which is needed for
+    /// nodes that outlive the document, such as cached spec descriptions.
+    /// \param[in] _arena Arena to activate, or nullptr.
+    public: explicit ElementArenaScope(std::shared_ptr<ElementArena> _arena);
+
+    /// \brief Destructor. Restores the previously active arena.
+    public: ~ElementArenaScope();
+
+    /// \brief Scopes can not be copied.
+    public: ElementArenaScope(const ElementArenaScope &) = delete;
+
+    /// \brief Scopes can not be copied.
+    public: ElementArenaScope &operator=(const ElementArenaScope &) = delete;
+
+    /// \brief Arena that was active before this scope.
+    private: std::shared_ptr<ElementArena> previous;
+  };
+
+  /// \internal
+  /// \brief Create a shared object, allocated from the active arena if there
+  /// is one, and from the heap otherwise.
+  /// \param[in] _args Arguments forwarded to the constructor of T.
+  /// \return The new object.
+  template <typename T, typename... Args>
+  std::shared_ptr<T> makeArenaShared(Args &&..._args)
+  {
+    std::shared_ptr<ElementArena> arena = ElementArena::Active();
+    if (arena)
+    {
+      return std::allocate_shared<T>(
+          ElementArenaAllocator<T>(std::move(arena)),
+          std::forward<Args>(_args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(_args)...);
+  }
+  }
+}
+#endif
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gz/math/Pose3.hh>
+
+#include "sdf/Element.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+#include "ElementArena.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+TEST(ElementArena, Allocate)
+{
+  sdf::ElementArena arena(1024);
+  EXPECT_EQ(0u, arena.BlockCount());
+
+  void *first = arena.Allocate(10, 1);
+  void *second = arena.Allocate(8, 8);
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, second);
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(second) % 8);
+  EXPECT_EQ(1u, arena.BlockCount());
+
+  // Large objects get a block of their own
+  EXPECT_NE(nullptr, arena.Allocate(4096, 16));
+  EXPECT_EQ(2u, arena.BlockCount());
+
+  // Small objects keep using the current block until it is full
+  EXPECT_NE(nullptr, arena.Allocate(8, 8));
+  EXPECT_EQ(2u, arena.BlockCount());
+  for (int i = 0; i < 200; ++i)
+    arena.Allocate(8, 8);
+  EXPECT_GT(arena.BlockCount(), 2u);
+}
+
+/////////////////////////////////////////////////
+TEST(ElementArena, Scope)
+{
+  EXPECT_EQ(nullptr, sdf::ElementArena::Active());
+
+  sdf::ParserConfig config;
+  {
+    sdf::ElementArenaScope scope(config);
+    EXPECT_EQ(nullptr, sdf::ElementArena::Active());
+  }
+
+  config.SetArenaAllocation(true);
+  std::weak_ptr<sdf::ElementArena> weakArena;
+  sdf::ElementPtr elem;
+  {
+    sdf::ElementArenaScope scope(config);
+    std::shared_ptr<sdf::ElementArena> arena = sdf::ElementArena::Active();
+    ASSERT_NE(nullptr, arena);
+    weakArena = arena;
+
+    // Nested scopes reuse the active arena
+    {
+      sdf::ElementArenaScope nested(config);
+      EXPECT_EQ(arena, sdf::ElementArena::Active());
+    }
+    EXPECT_EQ(arena, sdf::ElementArena::Active());
+
+    // Scopes can switch back to the heap temporarily
+    {
+      sdf::ElementArenaScope heapScope(nullptr);
+      EXPECT_EQ(nullptr, sdf::ElementArena::Active());
+    }
+    EXPECT_EQ(arena, sdf::ElementArena::Active());
+
+    elem = sdf::makeArenaShared<sdf::Element>();
+    elem->AddAttribute("name", "string", "", false);
+    EXPECT_GT(arena->BlockCount(), 0u);
+  }
+  EXPECT_EQ(nullptr, sdf::ElementArena::Active());
+
+  // The element keeps the arena alive
+  EXPECT_FALSE(weakArena.expired());
+  ASSERT_NE(nullptr, elem->GetAttribute("name"));
+  elem->GetAttribute("name")->Set<std::string>("test");
+  EXPECT_EQ("test", elem->GetAttribute("name")->GetAsString());
+
+  elem.reset();
+  EXPECT_TRUE(weakArena.expired());
+}
+
+/////////////////////////////////////////////////
+TEST(ElementArena, Threads)
+{
+  sdf::ParserConfig config;
+  config.SetArenaAllocation(true);
+  sdf::ElementArenaScope scope(config);
+  std::shared_ptr<sdf::ElementArena> arena = sdf::ElementArena::Active();
+  ASSERT_NE(nullptr, arena);
+  EXPECT_EQ(0u, arena->BlockCount());
+
+  // The active arena is per thread, so other threads have to activate the
+  // arena of the thread that started the parse.
+  sdf::ElementPtr elem;
+  std::thread thread([&]()
+  {
+    EXPECT_EQ(nullptr, sdf::ElementArena::Active());
+    sdf::ElementArenaScope workerScope(arena);
+    EXPECT_EQ(arena, sdf::ElementArena::Active());
+    elem = sdf::makeArenaShared<sdf::Element>();
+  });
+  thread.join();
+
+  ASSERT_NE(nullptr, elem);
+  EXPECT_EQ(1u, arena->BlockCount());
+}
+
+/////////////////////////////////////////////////
+TEST(ElementArena, ReadString)
+{
+  const std::string sdfString = R"(
+<sdf version='1.11'>
+  <world name='default'>
+    <model name='box'>
+      <pose>1 2 3 0 0 0</pose>
+      <link name='link'>
+        <collision name='collision'>
+          <geometry><box><size>1 1 1</size></box></geometry>
+        </collision>
+      </link>
+    </model>
+    <include>
+      <uri>arena_probe</uri>
+      <name>probe</name>
+    </include>
+  </world>
+</sdf>)";
+
+  // The find file callback runs while the document is read, so it sees the
+  // arena that the read allocates from.
+  std::shared_ptr<sdf::ElementArena> readArena;
+  auto findFile = [&readArena](const std::string &)
+  {
+    readArena = sdf::ElementArena::Active();
+    return sdf::testing::TestFile("integration", "model", "box");
+  };
+
+  sdf::ParserConfig heapConfig;
+  heapConfig.SetFindCallback(findFile);
+  sdf::SDFPtr heapSdf(new sdf::SDF());
+  sdf::init(heapSdf);
+  sdf::Errors errors;
+  ASSERT_TRUE(sdf::readString(sdfString, heapConfig, heapSdf, errors));
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(nullptr, readArena);
+
+  sdf::ParserConfig arenaConfig;
+  arenaConfig.SetArenaAllocation(true);
+  arenaConfig.SetFindCallback(findFile);
+  sdf::SDFPtr arenaSdf(new sdf::SDF());
+  sdf::init(arenaSdf);
+  ASSERT_TRUE(sdf::readString(sdfString, arenaConfig, arenaSdf, errors));
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(nullptr, sdf::ElementArena::Active());
+
+  // The elements were allocated from the arena, and keep it alive
+  ASSERT_NE(nullptr, readArena);
+  EXPECT_GT(readArena->BlockCount(), 0u);
+  EXPECT_GT(readArena.use_count(), 1);
+
+  EXPECT_EQ(heapSdf->Root()->ToString(""), arenaSdf->Root()->ToString(""));
+
+  // Elements of the document remain usable after the document is released
+  sdf::ElementPtr model =
+      arenaSdf->Root()->GetElement("world")->GetElement("model");
+  arenaSdf.reset();
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ("box", model->Get<std::string>("name"));
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            model->Get<gz::math::Pose3d>("pose"));
+  EXPECT_GT(readArena.use_count(), 1);
+
+  // Releasing the last element releases the arena
+  model.reset();
+  EXPECT_EQ(1, readArena.use_count());
+}
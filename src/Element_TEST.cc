@@ -15,8 +15,14 @@
  *
  */
 
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include <gz/math/Pose3.hh>
+
 #include "sdf/Element.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/Param.hh"
@@ -350,7 +356,7 @@ TEST(Element, AddElementReferenceSDF)
 
   ASSERT_EQ(child->GetElementDescriptionCount(), 1UL);
 
-  sdf::ElementPtr check = child->GetElementDescription(4);
+  sdf::ElementConstPtr check = child->GetElementDescription(4);
   ASSERT_EQ(check, sdf::ElementPtr());
 
   check = child->GetElementDescription(0);
@@ -391,6 +397,57 @@ TEST(Element, GetTemplates)
   ASSERT_EQ(found, true);
 }
 
+/////////////////////////////////////////////////
+TEST(Element, GetTemplatesWithoutConversion)
+{
+  sdf::ElementPtr elem = std::make_shared<sdf::Element>();
+  elem->SetName("link");
+  elem->AddAttribute("name", "string", "link", true, "name");
+
+  sdf::ElementPtr poseDesc = std::make_shared<sdf::Element>();
+  poseDesc->SetName("pose");
+  poseDesc->AddValue("pose", "0 0 0 0 0 0", false, "pose");
+  elem->AddElementDescription(poseDesc);
+
+  sdf::ElementPtr massDesc = std::make_shared<sdf::Element>();
+  massDesc->SetName("mass");
+  massDesc->AddValue("double", "1.0", false, "mass");
+  elem->AddElementDescription(massDesc);
+
+  sdf::ElementPtr pose = elem->AddElement("pose");
+  ASSERT_TRUE(pose->Set(gz::math::Pose3d(1, 2, 3, 0, 0, 0)));
+
+  // Values are read from attributes, values, child elements and element
+  // descriptions.
+  sdf::Errors errors;
+  EXPECT_EQ("link", elem->Get<std::string>(errors, "name"));
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            elem->Get<gz::math::Pose3d>(errors, "pose"));
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            pose->Get<gz::math::Pose3d>(errors));
+  EXPECT_DOUBLE_EQ(1.0, elem->Get<double>(errors, "mass"));
+
+  std::pair<double, bool> pairout = elem->Get<double>(errors, "mass", 2.0);
+  EXPECT_DOUBLE_EQ(1.0, pairout.first);
+  EXPECT_TRUE(pairout.second);
+
+  pairout = elem->Get<double>(errors, "missing", 2.0);
+  EXPECT_DOUBLE_EQ(2.0, pairout.first);
+  EXPECT_FALSE(pairout.second);
+
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  // The values are held with their own types
+  ASSERT_NE(nullptr, pose->GetValue()->GetIf<gz::math::Pose3d>());
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            *pose->GetValue()->GetIf<gz::math::Pose3d>());
+  EXPECT_EQ(nullptr, pose->GetValue()->GetIf<double>());
+
+  // Other types are converted
+  EXPECT_EQ(1, elem->Get<int>(errors, "mass"));
+  EXPECT_TRUE(errors.empty()) << errors;
+}
+
 /////////////////////////////////////////////////
 TEST(Element, Clone)
 {
@@ -443,6 +500,12 @@ TEST(Element, Clone)
 
   auto clonedAttribs = newelem->GetAttributes();
   EXPECT_EQ(newelem, clonedAttribs[0]->GetParentElement());
+
+  // Element descriptions are shared, values and children are not
+  EXPECT_EQ(desc, newelem->GetElementDescription(0));
+  EXPECT_NE(parent->GetFirstElement(), newelem->GetFirstElement());
+  EXPECT_NE(parent->GetValue(), newelem->GetValue());
+  EXPECT_NE(parent->GetAttribute("test"), newelem->GetAttribute("test"));
 }
 
 /////////////////////////////////////////////////
@@ -1090,3 +1153,210 @@ TEST(Element, FindElement)
     EXPECT_EQ("first_child", childElemB->GetAttribute("name")->GetAsString());
   }
 }
+
+/////////////////////////////////////////////////
+TEST(Element, ChildNameIndex)
+{
+  sdf::ElementPtr root = std::make_shared<sdf::Element>();
+  root->SetName("root");
+
+  auto first = addChildElement(root, "child", true, "first");
+  auto second = addChildElement(root, "child", true, "second");
+  auto other = addChildElement(root, "other", false, "");
+
+  EXPECT_EQ(first, root->FindElement("child"));
+  EXPECT_EQ(other, root->FindElement("other"));
+  EXPECT_EQ(2u, root->GetElementCount("child"));
+  EXPECT_EQ(1u, root->GetElementCount("other"));
+  EXPECT_EQ(0u, root->GetElementCount("missing"));
+
+  // Removing the first child makes the next one with the same name the
+  // first match
+  root->RemoveChild(first);
+  EXPECT_EQ(second, root->FindElement("child"));
+  EXPECT_EQ(1u, root->GetElementCount("child"));
+
+  first->SetParent(root);
+  root->InsertElement(first);
+  EXPECT_EQ(second, root->FindElement("child"));
+
+  second->RemoveFromParent();
+  EXPECT_EQ(first, root->FindElement("child"));
+
+  // Renaming a child updates the index of its parent
+  other->SetName("renamed");
+  EXPECT_EQ(nullptr, root->FindElement("other"));
+  EXPECT_EQ(other, root->FindElement("renamed"));
+  EXPECT_TRUE(root->HasElement("renamed"));
+
+  // Clones and copies get their own index
+  sdf::ElementPtr clone = root->Clone();
+  ASSERT_NE(nullptr, clone->FindElement("renamed"));
+  EXPECT_NE(other, clone->FindElement("renamed"));
+  EXPECT_EQ(clone, clone->FindElement("renamed")->GetParent());
+
+  sdf::ElementPtr copy = std::make_shared<sdf::Element>();
+  copy->Copy(root);
+  ASSERT_NE(nullptr, copy->FindElement("child"));
+  EXPECT_EQ("first",
+      copy->FindElement("child")->GetAttribute("name")->GetAsString());
+
+  root->ClearElements();
+  EXPECT_FALSE(root->HasElement("child"));
+  EXPECT_EQ(0u, root->GetElementCount("child"));
+  EXPECT_FALSE(root->HasElement("renamed"));
+  EXPECT_NE(nullptr, clone->FindElement("child"));
+}
+
+/////////////////////////////////////////////////
+TEST(Element, ChildNameIndexManyChildren)
+{
+  // Elements with many children look them up through a name index, which
+  // must give the same results as the scan used for few children.
+  sdf::ElementPtr root = std::make_shared<sdf::Element>();
+  root->SetName("root");
+
+  std::vector<sdf::ElementPtr> children;
+  for (int i = 0; i < 20; ++i)
+  {
+    children.push_back(addChildElement(root, i % 2 ? "odd" : "even", true,
+                                       std::to_string(i)));
+  }
+  EXPECT_EQ(children[0], root->FindElement("even"));
+  EXPECT_EQ(children[1], root->FindElement("odd"));
+  EXPECT_EQ(10u, root->GetElementCount("even"));
+  EXPECT_EQ(children[2], children[0]->GetNextElement("even"));
+
+  // A renamed child is moved in the index of its parent, and keeps its
+  // position among the children with its new name.
+  children[6]->SetName("odd");
+  EXPECT_EQ(9u, root->GetElementCount("even"));
+  EXPECT_EQ(11u, root->GetElementCount("odd"));
+  EXPECT_EQ(children[6], children[5]->GetNextElement("odd"));
+  EXPECT_EQ(children[7], children[6]->GetNextElement("odd"));
+  EXPECT_EQ(children[8], children[4]->GetNextElement("even"));
+
+  children[1]->SetName("renamed");
+  EXPECT_EQ(children[1], root->FindElement("renamed"));
+  EXPECT_EQ(children[3], root->FindElement("odd"));
+  EXPECT_EQ(nullptr, children[1]->GetNextElement("renamed"));
+
+  children[0]->SetName("odd");
+  EXPECT_EQ(children[0], root->FindElement("odd"));
+  EXPECT_EQ(children[3], children[0]->GetNextElement("odd"));
+  EXPECT_EQ(children[2], root->FindElement("even"));
+
+  // Removed children leave the index
+  root->RemoveChild(children[0]);
+  EXPECT_EQ(children[3], root->FindElement("odd"));
+  EXPECT_EQ(10u, root->GetElementCount("odd"));
+
+  // Clones get the same lookups
+  sdf::ElementPtr clone = root->Clone();
+  EXPECT_EQ(10u, clone->GetElementCount("odd"));
+  ASSERT_NE(nullptr, clone->FindElement("renamed"));
+  EXPECT_EQ("1",
+      clone->FindElement("renamed")->GetAttribute("name")->GetAsString());
+}
+
+/////////////////////////////////////////////////
+TEST(Element, ElementDescriptionIndex)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  sdf::ElementPtr descA = std::make_shared<sdf::Element>();
+  descA->SetName("a");
+  sdf::ElementPtr descB = std::make_shared<sdf::Element>();
+  descB->SetName("b");
+  parent->AddElementDescription(descA);
+  parent->AddElementDescription(descB);
+
+  EXPECT_EQ(descA, parent->GetElementDescription("a"));
+  EXPECT_EQ(descB, parent->GetElementDescription("b"));
+  EXPECT_EQ(nullptr, parent->GetElementDescription("c"));
+
+  // Descriptions are shared, so they are only handed out read-only
+  static_assert(std::is_same_v<sdf::ElementConstPtr,
+      decltype(parent->GetElementDescription("a"))>);
+  static_assert(std::is_same_v<sdf::ElementConstPtr,
+      decltype(parent->GetElementDescription(0))>);
+
+  // Adding a description to a clone does not change the original
+  sdf::ElementPtr clone = parent->Clone();
+  sdf::ElementPtr descC = std::make_shared<sdf::Element>();
+  descC->SetName("c");
+  clone->AddElementDescription(descC);
+  EXPECT_EQ(descC, clone->GetElementDescription("c"));
+  EXPECT_EQ(descA, clone->GetElementDescription("a"));
+  EXPECT_FALSE(parent->HasElementDescription("c"));
+
+  sdf::ElementPtr elem = clone->AddElement("c");
+  ASSERT_NE(nullptr, elem);
+  EXPECT_EQ(elem, clone->FindElement("c"));
+
+  // Adding a description to the original does not change the clone
+  sdf::ElementPtr descD = std::make_shared<sdf::Element>();
+  descD->SetName("d");
+  parent->AddElementDescription(descD);
+  EXPECT_EQ(descD, parent->GetElementDescription("d"));
+  EXPECT_FALSE(clone->HasElementDescription("d"));
+  EXPECT_FALSE(parent->HasElementDescription("c"));
+}
+
+/////////////////////////////////////////////////
+TEST(Element, GetNextElementAfterRemoval)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  std::vector<sdf::ElementPtr> models;
+  for (int i = 0; i < 5; ++i)
+  {
+    models.push_back(addChildElement(parent, "model", true,
+                                     "model" + std::to_string(i)));
+    addChildElement(parent, "light", false, "");
+  }
+
+  auto countNamed = [&](const std::string &_name)
+  {
+    int count = 0;
+    for (auto elem = parent->FindElement(_name); elem;
+         elem = elem->GetNextElement(_name))
+    {
+      ++count;
+    }
+    return count;
+  };
+
+  auto countAll = [&]()
+  {
+    int count = 0;
+    for (auto elem = parent->GetFirstElement(); elem;
+         elem = elem->GetNextElement())
+    {
+      ++count;
+    }
+    return count;
+  };
+
+  EXPECT_EQ(5, countNamed("model"));
+  EXPECT_EQ(5, countNamed("light"));
+  EXPECT_EQ(10, countAll());
+
+  // Siblings after a removed element are still found
+  parent->RemoveChild(models[1]);
+  EXPECT_EQ(4, countNamed("model"));
+  EXPECT_EQ(9, countAll());
+  EXPECT_EQ(models[2], models[0]->GetNextElement("model"));
+  EXPECT_EQ("light", models[0]->GetNextElement()->GetName());
+  EXPECT_EQ(models[2], models[0]->GetNextElement("light")->GetNextElement());
+
+  // An element inserted into another parent keeps working in its own parent
+  sdf::ElementPtr other = std::make_shared<sdf::Element>();
+  other->InsertElement(models[3]);
+  EXPECT_EQ(models[4], models[3]->GetNextElement("model"));
+  EXPECT_EQ(4, countNamed("model"));
+
+  // Renamed siblings
+  models[2]->SetName("renamed");
+  EXPECT_EQ(models[3], models[0]->GetNextElement("model"));
+  EXPECT_EQ(nullptr, models[2]->GetNextElement("renamed"));
+  EXPECT_EQ(models[3], models[2]->GetNextElement("model"));
+}
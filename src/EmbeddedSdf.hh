@@ -18,6 +18,7 @@
 #ifndef SDF_EMBEDDEDSDF_HH_
 #define SDF_EMBEDDEDSDF_HH_
 
+#include <cstddef>
 #include <map>
 #include <string>
 
@@ -35,6 +36,94 @@ namespace sdf
   /// directory such as "1.8/root.sdf", and the values are the contents of
   /// that source file.
   const std::map<std::string, std::string> &GetEmbeddedSdf();
+
+  /// \brief Precompiled description of an <attribute> in a spec file.
+  struct EmbeddedSdfAttribute
+  {
+    /// \brief Name of the attribute.
+    const char *name;
+
+    /// \brief Type name of the attribute value.
+    const char *type;
+
+    /// \brief Default value of the attribute.
+    const char *defaultValue;
+
+    /// \brief True if the attribute is required.
+    bool required;
+
+    /// \brief Text description of the attribute.
+    const char *description;
+  };
+
+  /// \brief Precompiled <include> of another spec file.
+  struct EmbeddedSdfInclude
+  {
+    /// \brief Name of the included spec file, e.g. "link.sdf".
+    const char *filename;
+
+    /// \brief Description that overrides the one of the included element, or
+    /// nullptr to keep the description of the included element.
+    const char *description;
+  };
+
+  /// \brief Precompiled description of an <element> in a spec file. This
+  /// holds everything sdf::initXml reads from the spec XML.
+  struct EmbeddedSdfElement
+  {
+    /// \brief Name of the element.
+    const char *name;
+
+    /// \brief Requirement string of the element.
+    const char *required;
+
+    /// \brief Name of the reference SDF element, or nullptr.
+    const char *ref;
+
+    /// \brief Type name of the element value, or nullptr if the element
+    /// has no value.
+    const char *type;
+
+    /// \brief Default value of the element value, or nullptr if the element
+    /// has no value.
+    const char *defaultValue;
+
+    /// \brief Minimum allowed value, or an empty string.
+    const char *minValue;
+
+    /// \brief Maximum allowed value, or an empty string.
+    const char *maxValue;
+
+    /// \brief Text description of the element, or nullptr.
+    const char *description;
+
+    /// \brief True if child elements should be copied during parsing.
+    bool copyChildren;
+
+    /// \brief Attributes of the element.
+    const EmbeddedSdfAttribute *attributes;
+
+    /// \brief Number of attributes.
+    std::size_t attributeCount;
+
+    /// \brief Descriptions of the child elements.
+    const EmbeddedSdfElement *elements;
+
+    /// \brief Number of child element descriptions.
+    std::size_t elementCount;
+
+    /// \brief Spec files included as child element descriptions.
+    const EmbeddedSdfInclude *includes;
+
+    /// \brief Number of included spec files.
+    std::size_t includeCount;
+  };
+
+  /// A map where the keys are source-relative pathnames of spec files such as
+  /// "1.8/root.sdf", and the values are the precompiled descriptions of the
+  /// root <element> of those files.
+  const std::map<std::string, const EmbeddedSdfElement *>
+      &GetEmbeddedSdfDescriptions();
 }
 }
 #endif
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "sdf/Filesystem.hh"
+#include "FindFileCache.hh"
+
+using namespace sdf;
+
+/////////////////////////////////////////////////
+bool FindFileCache::Get(const std::string &_filename, bool _searchLocalPath,
+                        bool _useCallback, std::string &_path)
+{
+  const std::string key = Key(_filename, _searchLocalPath, _useCallback);
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  auto it = this->paths.find(key);
+  if (it == this->paths.end())
+  {
+    ++this->missCount;
+    return false;
+  }
+
+  ++this->hitCount;
+  _path = it->second;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void FindFileCache::Insert(const std::string &_filename,
+                           bool _searchLocalPath, bool _useCallback,
+                           const std::string &_path)
+{
+  std::string key = Key(_filename, _searchLocalPath, _useCallback);
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->paths.insert_or_assign(std::move(key), _path);
+}
+
+/////////////////////////////////////////////////
+void FindFileCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->paths.clear();
+}
+
+/////////////////////////////////////////////////
+std::size_t FindFileCache::Size() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->paths.size();
+}
+
+/////////////////////////////////////////////////
+std::size_t FindFileCache::HitCount() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->hitCount;
+}
+
+/////////////////////////////////////////////////
+std::size_t FindFileCache::MissCount() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->missCount;
+}
+
+/////////////////////////////////////////////////
+std::string FindFileCache::Key(const std::string &_filename,
+                               bool _searchLocalPath, bool _useCallback)
+{
+  // The flags and the current directory are separated from the file name by
+  // a newline. Relative names are also looked up as they are, i.e. in the
+  // current directory, even if it is not searched first.
+  std::string key;
+  key += _searchLocalPath ? 'l' : '-';
+  key += _useCallback ? 'c' : '-';
+  if (_searchLocalPath || !std::filesystem::path(_filename).is_absolute())
+    key += sdf::filesystem::current_path();
+  key += '\n';
+  key += _filename;
+  return key;
+}
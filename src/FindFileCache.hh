@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_FINDFILECACHE_HH_
+#define SDF_FINDFILECACHE_HH_
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Cache of the paths found by sdf::findFile(), so that a URI used
+  /// many times, e.g. by the includes and meshes of a world, is only looked
+  /// up on the filesystem once. Lookups that found no file are cached too.
+  ///
+  /// Results are keyed by the file name, the search flags and, when the
+  /// current directory is searched or the file name is relative, the
+  /// current directory. Changes to the
+  /// filesystem or to the SDF_PATH environment variable are not noticed
+  /// until the cache is cleared. The cache can be used by several threads
+  /// at once.
+  class FindFileCache
+  {
+    /// \brief Get a cached path.
+    /// \param[in] _filename Name of the file to find.
+    /// \param[in] _searchLocalPath True if the current directory is searched.
+    /// \param[in] _useCallback True if the find file callback is used.
+    /// \param[out] _path The cached path, empty if no file was found.
+    /// \return True if the lookup was in the cache.
+    public: bool Get(const std::string &_filename, bool _searchLocalPath,
+                     bool _useCallback, std::string &_path);
+
+    /// \brief Add the result of a lookup to the cache.
+    /// \param[in] _filename Name of the file to find.
+    /// \param[in] _searchLocalPath True if the current directory is searched.
+    /// \param[in] _useCallback True if the find file callback is used.
+    /// \param[in] _path The path found, empty if no file was found.
+    public: void Insert(const std::string &_filename, bool _searchLocalPath,
+                        bool _useCallback, const std::string &_path);
+
+    /// \brief Remove all cached paths. The counters are kept.
+    public: void Clear();
+
+    /// \brief Get the number of cached lookups.
+    /// \return Number of cached lookups.
+    public: std::size_t Size() const;
+
+    /// \brief Get the number of lookups found in the cache.
+    /// \return Number of successful calls to Get.
+    public: std::size_t HitCount() const;
+
+    /// \brief Get the number of lookups not found in the cache.
+    /// \return Number of unsuccessful calls to Get.
+    public: std::size_t MissCount() const;
+
+    /// \brief Get the key of a lookup.
+    /// \param[in] _filename Name of the file to find.
+    /// \param[in] _searchLocalPath True if the current directory is searched.
+    /// \param[in] _useCallback True if the find file callback is used.
+    /// \return Key of the lookup in the cache.
+    private: static std::string Key(const std::string &_filename,
+                                    bool _searchLocalPath, bool _useCallback);
+
+    /// \brief Cached paths by key.
+    private: std::unordered_map<std::string, std::string> paths;
+
+    /// \brief Number of lookups found in the cache.
+    private: std::size_t hitCount = 0;
+
+    /// \brief Number of lookups not found in the cache.
+    private: std::size_t missCount = 0;
+
+    /// \brief Mutex to use the cache from several threads.
+    private: mutable std::mutex mutex;
+  };
+  }
+}
+#endif
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "FindFileCache.hh"
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, GetInsert)
+{
+  sdf::FindFileCache cache;
+  std::string path;
+  EXPECT_FALSE(cache.Get("model://box", true, true, path));
+  EXPECT_EQ(0u, cache.HitCount());
+  EXPECT_EQ(1u, cache.MissCount());
+
+  cache.Insert("model://box", true, true, "/models/box");
+  cache.Insert("model://missing", true, true, "");
+  EXPECT_EQ(2u, cache.Size());
+
+  EXPECT_TRUE(cache.Get("model://box", true, true, path));
+  EXPECT_EQ("/models/box", path);
+
+  // Lookups that found no file are cached too
+  path = "unchanged";
+  EXPECT_TRUE(cache.Get("model://missing", true, true, path));
+  EXPECT_TRUE(path.empty());
+  EXPECT_EQ(2u, cache.HitCount());
+  EXPECT_EQ(1u, cache.MissCount());
+
+  // Lookups with other flags are cached separately
+  EXPECT_FALSE(cache.Get("model://box", false, true, path));
+  EXPECT_FALSE(cache.Get("model://box", true, false, path));
+  EXPECT_EQ(3u, cache.MissCount());
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_FALSE(cache.Get("model://box", true, true, path));
+  EXPECT_EQ(2u, cache.HitCount());
+  EXPECT_EQ(4u, cache.MissCount());
+}
+
+/////////////////////////////////////////////////
+TEST(FindFileCache, CurrentDirectory)
+{
+  const std::filesystem::path prevPath = std::filesystem::current_path();
+  const std::filesystem::path tmpPath =
+      std::filesystem::temp_directory_path() / "sdf_find_file_cache";
+  std::filesystem::create_directories(tmpPath);
+  const std::string absolute = (tmpPath / "box.sdf").string();
+
+  sdf::FindFileCache cache;
+  cache.Insert("box.sdf", false, false, "box.sdf");
+  cache.Insert(absolute, false, false, absolute);
+
+  // Relative names are found in the current directory even if it is not
+  // searched first, so they are cached per directory
+  std::string path;
+  std::filesystem::current_path(tmpPath);
+  EXPECT_FALSE(cache.Get("box.sdf", false, false, path));
+  EXPECT_TRUE(cache.Get(absolute, false, false, path));
+  EXPECT_EQ(absolute, path);
+
+  std::filesystem::current_path(prevPath);
+  EXPECT_TRUE(cache.Get("box.sdf", false, false, path));
+  EXPECT_EQ("box.sdf", path);
+  std::filesystem::remove(tmpPath);
+}
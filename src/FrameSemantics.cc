@@ -15,6 +15,7 @@
  *
 */
 #include <algorithm>
+#include <mutex>
 #include <string>
 #include <set>
 #include <utility>
@@ -1744,6 +1745,48 @@ Errors resolvePoseRelativeToRoot(
 {
   Errors errors;
 
+  using VertexId = gz::math::graph::VertexId;
+  PoseRelativeToCache &cache = _graph.PoseCache();
+  const VertexId scopeId = _graph.ScopeVertexId();
+  if (cache.Get(scopeId, _vertexId, _pose))
+    return errors;
+
+  // Walk the incoming edges up to the scope vertex or to the first ancestor
+  // whose pose is cached. The walk stops at anything FindSourceVertex would
+  // report as an error, in which case FindSourceVertex walks it again below
+  // to report it.
+  gz::math::Pose3d pose;
+  std::vector<std::pair<VertexId, gz::math::Pose3d>> path;
+  VertexId id = _vertexId;
+  bool walked = _graph.Graph().VertexFromId(id).Valid();
+  while (walked && id != scopeId && !cache.Get(scopeId, id, pose))
+  {
+    const auto incidentsTo = _graph.Graph().IncidentsTo(id);
+    if (incidentsTo.size() != 1)
+    {
+      walked = false;
+      break;
+    }
+    const auto &edge = incidentsTo.begin()->second.get();
+    path.emplace_back(id, edge.Data());
+    id = edge.Vertices().first;
+    walked = std::none_of(path.begin(), path.end(),
+        [id](const auto &_step) { return _step.first == id; });
+  }
+
+  if (walked)
+  {
+    // Resolve and cache the poses of the vertices on the path, from the
+    // ancestor down to the queried vertex.
+    for (auto step = path.rbegin(); step != path.rend(); ++step)
+    {
+      pose = pose * step->second;
+      cache.Insert(scopeId, step->first, pose);
+    }
+    _pose = pose;
+    return errors;
+  }
+
   auto incomingVertexEdges = FindSourceVertex(_graph, _vertexId, errors);
 
   if (!errors.empty())
@@ -1782,6 +1825,38 @@ Errors resolvePoseRelativeToRoot(
   return errors;
 }
 
+/////////////////////////////////////////////////
+bool PoseRelativeToCache::Get(gz::math::graph::VertexId _scopeId,
+                              gz::math::graph::VertexId _vertexId,
+                              gz::math::Pose3d &_pose) const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  auto scopeIt = this->poses.find(_scopeId);
+  if (scopeIt == this->poses.end())
+    return false;
+  auto it = scopeIt->second.find(_vertexId);
+  if (it == scopeIt->second.end())
+    return false;
+  _pose = it->second;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void PoseRelativeToCache::Insert(gz::math::graph::VertexId _scopeId,
+                                 gz::math::graph::VertexId _vertexId,
+                                 const gz::math::Pose3d &_pose)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->poses[_scopeId].insert_or_assign(_vertexId, _pose);
+}
+
+/////////////////////////////////////////////////
+void PoseRelativeToCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->poses.clear();
+}
+
 /////////////////////////////////////////////////
 Errors resolvePose(gz::math::Pose3d &_pose,
     const ScopedGraph<PoseRelativeToGraph> &_graph,
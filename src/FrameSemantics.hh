@@ -19,7 +19,9 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <gz/math/Pose3.hh>
 #include <gz/math/graph/Graph.hh>
@@ -90,6 +92,42 @@ namespace sdf
     std::string scopeName;
   };
 
+  /// \brief Cache of the poses resolved by resolvePoseRelativeToRoot, so that
+  /// the pose of a frame relative to a scope vertex is computed once per
+  /// graph. ScopedGraph clears it whenever it changes the graph, and
+  /// Root::UpdateGraphs builds new graphs with empty caches. The cache can be
+  /// used by several threads at once.
+  class PoseRelativeToCache
+  {
+    /// \brief Get a cached pose.
+    /// \param[in] _scopeId Id of the scope vertex the pose is relative to.
+    /// \param[in] _vertexId Id of the vertex whose pose was resolved.
+    /// \param[out] _pose The cached pose. It is not changed on a miss.
+    /// \return True if the pose was in the cache.
+    public: bool Get(gz::math::graph::VertexId _scopeId,
+                     gz::math::graph::VertexId _vertexId,
+                     gz::math::Pose3d &_pose) const;
+
+    /// \brief Add a resolved pose to the cache.
+    /// \param[in] _scopeId Id of the scope vertex the pose is relative to.
+    /// \param[in] _vertexId Id of the vertex whose pose was resolved.
+    /// \param[in] _pose Pose of the vertex relative to the scope vertex.
+    public: void Insert(gz::math::graph::VertexId _scopeId,
+                        gz::math::graph::VertexId _vertexId,
+                        const gz::math::Pose3d &_pose);
+
+    /// \brief Remove all the poses from the cache.
+    public: void Clear();
+
+    /// \brief Resolved poses by scope vertex, then by vertex.
+    private: std::unordered_map<gz::math::graph::VertexId,
+        std::unordered_map<gz::math::graph::VertexId, gz::math::Pose3d>>
+        poses;
+
+    /// \brief Mutex to use the cache from several threads.
+    private: mutable std::mutex mutex;
+  };
+
   /// \brief Data structure for pose relative_to graphs for Model or World.
   struct PoseRelativeToGraph
   {
@@ -108,6 +146,10 @@ namespace sdf
 
     /// \brief Name of source vertex, either __model__ or world.
     std::string sourceName;
+
+    /// \brief Poses of the vertices relative to the scope vertices, filled
+    /// lazily by resolvePoseRelativeToRoot.
+    PoseRelativeToCache poseCache;
   };
 
   /// \brief Build a FrameAttachedToGraph for a model.
@@ -198,6 +240,9 @@ namespace sdf
 
   /// \brief Resolve pose of a vertex relative to its outgoing ancestor
   /// (analog of the root of a tree). This overload takes a vertex ID.
+  /// Resolved poses are cached in the graph, so only the first resolution of
+  /// a vertex walks its incoming edges, and only up to the first ancestor
+  /// whose pose is already known.
   /// \param[out] _pose Pose object to write.
   /// \param[in] _graph PoseRelativeToGraph to read from.
   /// \param[in] _vertexId Id of vertex whose pose is to be computed.
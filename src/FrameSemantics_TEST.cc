@@ -297,6 +297,55 @@ TEST(FrameSemantics, buildPoseRelativeToGraph)
         "invalid] in graph."));
 }
 
+/////////////////////////////////////////////////
+TEST(FrameSemantics, resolvePoseRelativeToRootCache)
+{
+  auto ownedGraph = std::make_shared<sdf::PoseRelativeToGraph>();
+  sdf::ScopedGraph<sdf::PoseRelativeToGraph> graph(ownedGraph);
+  graph = graph.AddScopeVertex(
+      "", "__model__", "__model__", sdf::FrameType::MODEL);
+  const auto scopeId = graph.ScopeVertexId();
+  const auto aId = graph.AddVertex("A", sdf::FrameType::FRAME).Id();
+  const auto bId = graph.AddVertex("B", sdf::FrameType::FRAME).Id();
+  const auto cId = graph.AddVertex("C", sdf::FrameType::FRAME).Id();
+  graph.AddEdge({scopeId, aId}, gz::math::Pose3d(1, 0, 0, 0, 0, 0));
+  auto edgeAB =
+      graph.AddEdge({aId, bId}, gz::math::Pose3d(0, 2, 0, 0, 0, 0));
+
+  // Resolving a vertex caches the poses of the vertices on its path
+  sdf::PoseRelativeToCache &cache = graph.PoseCache();
+  gz::math::Pose3d pose;
+  EXPECT_FALSE(cache.Get(scopeId, aId, pose));
+  EXPECT_TRUE(sdf::resolvePoseRelativeToRoot(pose, graph, "B").empty());
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 0, 0, 0, 0), pose);
+  EXPECT_TRUE(cache.Get(scopeId, aId, pose));
+  EXPECT_EQ(gz::math::Pose3d(1, 0, 0, 0, 0, 0), pose);
+  EXPECT_TRUE(cache.Get(scopeId, bId, pose));
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 0, 0, 0, 0), pose);
+  EXPECT_TRUE(sdf::resolvePoseRelativeToRoot(pose, graph, "B").empty());
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 0, 0, 0, 0), pose);
+
+  // Errors are reported as without the cache, and nothing is cached
+  sdf::Errors errors = sdf::resolvePoseRelativeToRoot(pose, graph, "C");
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::POSE_RELATIVE_TO_GRAPH_ERROR, errors[0].Code());
+  EXPECT_FALSE(cache.Get(scopeId, cId, pose));
+
+  // Adding or changing edges clears the cache
+  graph.AddEdge({bId, cId}, gz::math::Pose3d(0, 0, 3, 0, 0, 0));
+  EXPECT_FALSE(cache.Get(scopeId, bId, pose));
+  EXPECT_TRUE(sdf::resolvePoseRelativeToRoot(pose, graph, "B").empty());
+  EXPECT_TRUE(sdf::resolvePoseRelativeToRoot(pose, graph, "C").empty());
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0), pose);
+
+  graph.UpdateEdge(edgeAB, gz::math::Pose3d(0, 4, 0, 0, 0, 0));
+  EXPECT_FALSE(cache.Get(scopeId, bId, pose));
+  EXPECT_TRUE(sdf::resolvePoseRelativeToRoot(pose, graph, "C").empty());
+  EXPECT_EQ(gz::math::Pose3d(1, 4, 3, 0, 0, 0), pose);
+  EXPECT_TRUE(sdf::resolvePose(pose, graph, "C", "A").empty());
+  EXPECT_EQ(gz::math::Pose3d(0, 4, 3, 0, 0, 0), pose);
+}
+
 /////////////////////////////////////////////////
 TEST(NestedFrameSemantics, buildFrameAttachedToGraph_Model)
 {
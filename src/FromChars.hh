@@ -0,0 +1,246 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_FROMCHARS_HH_
+#define SDF_FROMCHARS_HH_
+
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "sdf/sdf_config.h"
+
+// std::from_chars for floating point numbers is missing from older standard
+// libraries, such as libstdc++ before GCC 11 and libc++ before macOS 13.3.
+// Those get a fallback that calls strtod_l and friends with the "C" locale,
+// which is locale independent as well, but has to copy the number into a
+// null-terminated string.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define SDF_FROMCHARS_FLOAT 1
+#else
+#define SDF_FROMCHARS_FLOAT 0
+#include <cctype>
+#include <cerrno>
+#include <clocale>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  namespace internal
+  {
+#if !SDF_FROMCHARS_FLOAT
+  // strtoC calls strtof_l, strtod_l or strtold_l with the "C" locale,
+  // selected by the type of its last argument.
+#ifdef _WIN32
+  using CLocale = _locale_t;
+  inline float strtoC(const char *_str, char **_end, float)
+  {
+    static const CLocale loc = _create_locale(LC_NUMERIC, "C");
+    return _strtof_l(_str, _end, loc);
+  }
+  inline double strtoC(const char *_str, char **_end, double)
+  {
+    static const CLocale loc = _create_locale(LC_NUMERIC, "C");
+    return _strtod_l(_str, _end, loc);
+  }
+  inline long double strtoC(const char *_str, char **_end, long double)
+  {
+    static const CLocale loc = _create_locale(LC_NUMERIC, "C");
+    return _strtold_l(_str, _end, loc);
+  }
+#else
+  /// \brief Get the "C" locale, created once.
+  inline locale_t cLocale()
+  {
+    static const locale_t loc = newlocale(LC_NUMERIC_MASK, "C", nullptr);
+    return loc;
+  }
+  inline float strtoC(const char *_str, char **_end, float)
+  {
+    return strtof_l(_str, _end, cLocale());
+  }
+  inline double strtoC(const char *_str, char **_end, double)
+  {
+    return strtod_l(_str, _end, cLocale());
+  }
+  inline long double strtoC(const char *_str, char **_end, long double)
+  {
+    return strtold_l(_str, _end, cLocale());
+  }
+#endif
+#endif
+
+  /// \internal
+  /// \brief Parse an unsigned floating point number, like std::from_chars.
+  /// \param[in] _first Start of the number.
+  /// \param[in] _last End of the string.
+  /// \param[out] _value The parsed number, set only on success.
+  /// \param[in] _hex True to parse a hexadecimal number, without its "0x"
+  /// prefix.
+  /// \return Same as std::from_chars.
+  template <typename T>
+  std::from_chars_result fromCharsFloat(const char *_first, const char *_last,
+                                        T &_value, bool _hex)
+  {
+#if SDF_FROMCHARS_FLOAT
+    return std::from_chars(_first, _last, _value,
+        _hex ? std::chars_format::hex : std::chars_format::general);
+#else
+    // strto* skip whitespace and read a sign, which std::from_chars would
+    // not, and they read a hexadecimal number only with its "0x" prefix.
+    if (_first == _last || *_first == '+' || *_first == '-' ||
+        std::isspace(static_cast<unsigned char>(*_first)))
+    {
+      return {_first, std::errc::invalid_argument};
+    }
+    if (!_hex && _last - _first > 1 && _first[0] == '0' &&
+        (_first[1] == 'x' || _first[1] == 'X'))
+    {
+      _value = 0;
+      return {_first + 1, std::errc()};
+    }
+
+    const std::string str = (_hex ? std::string("0x") : std::string()) +
+        std::string(_first, _last);
+    char *end = nullptr;
+    const int savedErrno = errno;
+    errno = 0;
+    const T value = strtoC(str.c_str(), &end, T());
+    const bool outOfRange = errno == ERANGE;
+    errno = savedErrno;
+
+    const std::ptrdiff_t count = end - str.c_str() - (_hex ? 2 : 0);
+    if (count <= 0)
+      return {_first, std::errc::invalid_argument};
+    if (outOfRange)
+      return {_first + count, std::errc::result_out_of_range};
+    _value = value;
+    return {_first + count, std::errc()};
+#endif
+  }
+  }
+
+  /// \internal
+  /// \brief Parse a number at the start of a string with std::from_chars.
+  /// Unlike std::strtod and friends, this does not depend on the global
+  /// locale, so the decimal separator is always a point and no global state
+  /// has to be changed. It accepts the same input as those functions do in
+  /// the "C" locale, except for leading whitespace: an optional sign, and
+  /// with _allowHex, an optional "0x" prefix for hexadecimal numbers. Like
+  /// std::strtoul, a negative unsigned number wraps around.
+  /// \param[in,out] _str String to parse. The parsed characters are removed
+  /// on success.
+  /// \param[out] _value The parsed number.
+  /// \param[in] _allowHex True to parse numbers with a "0x" prefix.
+  /// \return std::errc() on success, std::errc::invalid_argument if no number
+  /// was found, or std::errc::result_out_of_range if it does not fit in T.
+  template <typename T>
+  std::errc fromChars(std::string_view &_str, T &_value, bool _allowHex)
+  {
+    const char *first = _str.data();
+    const char *last = first + _str.size();
+
+    bool negative = false;
+    if (first != last && (*first == '+' || *first == '-'))
+    {
+      negative = *first == '-';
+      ++first;
+    }
+    if (first == last || *first == '+' || *first == '-')
+      return std::errc::invalid_argument;
+
+    const bool hex = _allowHex && last - first > 2 && first[0] == '0' &&
+        (first[1] == 'x' || first[1] == 'X');
+
+    std::from_chars_result result{first, std::errc::invalid_argument};
+    if constexpr (std::is_floating_point_v<T>)
+    {
+      T magnitude = 0;
+      if (hex)
+        result = internal::fromCharsFloat(first + 2, last, magnitude, true);
+      if (result.ec == std::errc::invalid_argument)
+        result = internal::fromCharsFloat(first, last, magnitude, false);
+      if (result.ec == std::errc())
+        _value = negative ? -magnitude : magnitude;
+    }
+    else
+    {
+      using UnsignedT = std::make_unsigned_t<T>;
+      UnsignedT magnitude = 0;
+      if (hex)
+        result = std::from_chars(first + 2, last, magnitude, 16);
+      if (result.ec == std::errc::invalid_argument)
+        result = std::from_chars(first, last, magnitude, 10);
+      if (result.ec != std::errc())
+        return result.ec;
+
+      if constexpr (std::is_signed_v<T>)
+      {
+        const UnsignedT limit =
+            static_cast<UnsignedT>(std::numeric_limits<T>::max()) + negative;
+        if (magnitude > limit)
+          return std::errc::result_out_of_range;
+        _value = negative ?
+            static_cast<T>(-static_cast<T>(magnitude - 1) - 1) :
+            static_cast<T>(magnitude);
+      }
+      else
+      {
+        _value = negative ? static_cast<T>(UnsignedT(0) - magnitude) :
+            magnitude;
+      }
+    }
+
+    if (result.ec == std::errc())
+      _str.remove_prefix(result.ptr - _str.data());
+    return result.ec;
+  }
+
+  /// \internal
+  /// \brief Locale independent replacement for std::stoi, std::stoul,
+  /// std::stod and std::stof. It parses a number at the start of a string
+  /// with fromChars, accepting hexadecimal numbers, and ignores the
+  /// characters after the number.
+  /// \param[in] _str String to parse.
+  /// \return The parsed number.
+  /// \throws std::invalid_argument if no number could be parsed.
+  /// \throws std::out_of_range if the number is out of range.
+  template <typename T>
+  T stringToNumber(std::string_view _str)
+  {
+    T value{};
+    const std::errc ec = fromChars(_str, value, true);
+    if (ec == std::errc::result_out_of_range)
+      throw std::out_of_range("stringToNumber");
+    if (ec != std::errc())
+      throw std::invalid_argument("stringToNumber");
+    return value;
+  }
+  }
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+#include "FromChars.hh"
+
+/////////////////////////////////////////////////
+TEST(FromChars, Integers)
+{
+  std::string_view str = "-42 rest";
+  int value = 0;
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_EQ(-42, value);
+  EXPECT_EQ(" rest", str);
+
+  str = "+7";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_EQ(7, value);
+
+  str = "0x1F";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, true));
+  EXPECT_EQ(31, value);
+
+  // Without hexadecimal numbers, only the leading zero is parsed
+  str = "0x1F";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_EQ(0, value);
+  EXPECT_EQ("x1F", str);
+
+  str = "-2147483648";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_EQ(std::numeric_limits<int>::min(), value);
+
+  str = "2147483648";
+  EXPECT_EQ(std::errc::result_out_of_range,
+            sdf::fromChars(str, value, false));
+  EXPECT_EQ("2147483648", str);
+
+  str = "+-1";
+  EXPECT_EQ(std::errc::invalid_argument, sdf::fromChars(str, value, false));
+
+  // Negative unsigned numbers wrap around, like std::strtoul
+  std::uint64_t unsignedValue = 0;
+  str = "-1";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, unsignedValue, false));
+  EXPECT_EQ(std::numeric_limits<std::uint64_t>::max(), unsignedValue);
+}
+
+/////////////////////////////////////////////////
+TEST(FromChars, FloatingPoint)
+{
+  std::string_view str = "1.5e2 2";
+  double value = 0;
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_DOUBLE_EQ(150.0, value);
+  EXPECT_EQ(" 2", str);
+
+  str = "-0X2A";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, true));
+  EXPECT_DOUBLE_EQ(-42.0, value);
+
+  str = "inf";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_TRUE(std::isinf(value));
+
+  // A comma is never a decimal separator
+  str = "0,5";
+  EXPECT_EQ(std::errc(), sdf::fromChars(str, value, false));
+  EXPECT_DOUBLE_EQ(0.0, value);
+
+  float floatValue = 0;
+  str = "1e100";
+  EXPECT_EQ(std::errc::result_out_of_range,
+            sdf::fromChars(str, floatValue, false));
+}
+
+/////////////////////////////////////////////////
+TEST(FromChars, StringToNumber)
+{
+  EXPECT_EQ(255, sdf::stringToNumber<int>("0xff"));
+  EXPECT_EQ(12, sdf::stringToNumber<int>("12abc"));
+  EXPECT_DOUBLE_EQ(0.123, sdf::stringToNumber<double>("0.123"));
+  EXPECT_THROW(sdf::stringToNumber<int>("abc"), std::invalid_argument);
+  EXPECT_THROW(sdf::stringToNumber<int>(""), std::invalid_argument);
+  EXPECT_THROW(sdf::stringToNumber<double>("1e1000"), std::out_of_range);
+}
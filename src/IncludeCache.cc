@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "ElementArena.hh"
+#include "IncludeCache.hh"
+
+using namespace sdf;
+
+/////////////////////////////////////////////////
+bool IncludeCache::Get(const std::string &_path, SDFPtr _sdf,
+                       sdf::Errors &_errors)
+{
+  std::error_code ec;
+  const auto modificationTime = std::filesystem::last_write_time(_path, ec);
+  if (ec)
+    return false;
+
+  ElementPtr root;
+  std::vector<PolicyCondition> printed;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto it = this->entries.find(_path);
+    if (it == this->entries.end() ||
+        it->second.modificationTime != modificationTime)
+    {
+      return false;
+    }
+
+    const Entry &entry = it->second;
+    root = entry.root;
+    _sdf->SetFilePath(entry.filePath);
+    _sdf->SetOriginalVersion(entry.originalVersion);
+    _errors.insert(_errors.end(), entry.errors.begin(), entry.errors.end());
+    printed = entry.printed;
+    ++this->hitCount;
+  }
+
+  // Warnings are printed as if the file was read again. The cache is
+  // replaced when the policies of the config change, so they still apply.
+  for (const PolicyCondition &condition : printed)
+  {
+    enforceConfigurablePolicyCondition(condition.policy, condition.error,
+                                       _errors);
+  }
+
+  // Cached elements are never modified, so they can be cloned without
+  // holding the lock.
+  _sdf->SetRoot(root->Clone());
+  return true;
+}
+
+/////////////////////////////////////////////////
+void IncludeCache::Insert(const std::string &_path, const SDFPtr &_sdf,
+                          const sdf::Errors &_errors,
+                          const std::vector<PolicyCondition> &_printed)
+{
+  std::error_code ec;
+  const auto modificationTime = std::filesystem::last_write_time(_path, ec);
+  if (ec)
+    return;
+
+  Entry entry;
+  entry.modificationTime = modificationTime;
+  {
+    // The cache outlives the document being read, so the copy is never
+    // allocated from the arena of that document.
+    ElementArenaScope heapScope(nullptr);
+    entry.root = _sdf->Root()->Clone();
+  }
+  entry.filePath = _sdf->FilePath();
+  entry.originalVersion = _sdf->OriginalVersion();
+  entry.errors = _errors;
+  entry.printed = _printed;
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->entries.insert_or_assign(_path, std::move(entry));
+}
+
+/////////////////////////////////////////////////
+std::size_t IncludeCache::Size() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->entries.size();
+}
+
+/////////////////////////////////////////////////
+std::size_t IncludeCache::HitCount() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->hitCount;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_INCLUDECACHE_HH_
+#define SDF_INCLUDECACHE_HH_
+
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sdf/Element.hh"
+#include "sdf/Error.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/sdf_config.h"
+#include "Utils.hh"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Cache of the documents read for <include> elements, so that a
+  /// file included many times is read, converted and built into elements
+  /// only once. Each include gets a copy of the cached document, to which
+  /// its overrides are applied.
+  ///
+  /// Documents are keyed by the resolved path of the file, and are read
+  /// again when the modification time of the file changes. Files included
+  /// by a cached document are not checked. The cache can be used by several
+  /// threads at once.
+  class IncludeCache
+  {
+    /// \brief Get a copy of a cached document.
+    /// \param[in] _path Resolved path of the included file.
+    /// \param[in,out] _sdf Document to set the root element, file path and
+    /// original version of.
+    /// \param[out] _errors The errors reported when the file was read are
+    /// appended to it. The warnings printed when the file was read are
+    /// printed again.
+    /// \return True if the file was in the cache and has not changed since.
+    public: bool Get(const std::string &_path, SDFPtr _sdf,
+                     sdf::Errors &_errors);
+
+    /// \brief Add a copy of a document to the cache.
+    /// \param[in] _path Resolved path of the included file.
+    /// \param[in] _sdf Document read from the file.
+    /// \param[in] _errors Errors reported when the file was read.
+    /// \param[in] _printed Warnings printed when the file was read.
+    public: void Insert(const std::string &_path, const SDFPtr &_sdf,
+                        const sdf::Errors &_errors,
+                        const std::vector<PolicyCondition> &_printed);
+
+    /// \brief Get the number of cached documents.
+    /// \return Number of cached documents.
+    public: std::size_t Size() const;
+
+    /// \brief Get the number of times a cached document was used.
+    /// \return Number of successful calls to Get.
+    public: std::size_t HitCount() const;
+
+    /// \brief A cached document.
+    private: struct Entry
+    {
+      /// \brief Modification time of the file when it was read.
+      std::filesystem::file_time_type modificationTime;
+
+      /// \brief Root element of the document.
+      ElementPtr root;
+
+      /// \brief File path of the document.
+      std::string filePath;
+
+      /// \brief Spec version the document was originally parsed from.
+      std::string originalVersion;
+
+      /// \brief Errors reported when the file was read.
+      sdf::Errors errors;
+
+      /// \brief Warnings printed when the file was read.
+      std::vector<PolicyCondition> printed;
+    };
+
+    /// \brief Cached documents by resolved path.
+    private: std::unordered_map<std::string, Entry> entries;
+
+    /// \brief Number of times a cached document was used.
+    private: std::size_t hitCount = 0;
+
+    /// \brief Mutex to use the cache from several threads.
+    private: mutable std::mutex mutex;
+  };
+  }
+}
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/Filesystem.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+#include "IncludeCache.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+TEST(IncludeCache, GetInsert)
+{
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string path =
+      sdf::filesystem::append(tmpDir, "include_cache_model.sdf");
+  {
+    std::ofstream file(path);
+    file << "<sdf version='1.11'><model name='model'>"
+         << "<link name='link'/></model></sdf>";
+  }
+
+  sdf::IncludeCache cache;
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf);
+  sdf::Errors errors;
+  EXPECT_FALSE(cache.Get(path, sdf, errors));
+  ASSERT_TRUE(sdf::readFile(path, sdf, errors));
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  sdf::Errors readErrors;
+  readErrors.push_back({sdf::ErrorCode::WARNING, "warning"});
+  const std::vector<sdf::PolicyCondition> printed = {
+      {sdf::EnforcementPolicy::LOG,
+       {sdf::ErrorCode::ELEMENT_INCORRECT_TYPE, "printed"}}};
+  cache.Insert(path, sdf, readErrors, printed);
+  EXPECT_EQ(1u, cache.Size());
+  EXPECT_EQ(0u, cache.HitCount());
+
+  // Each hit gets its own copy of the document and the errors of the read
+  // and prints the warnings of the read again
+  sdf::SDFPtr first(new sdf::SDF());
+  sdf::SDFPtr second(new sdf::SDF());
+  {
+    sdf::PolicyConditionRecorder recorder;
+    EXPECT_TRUE(cache.Get(path, first, errors));
+    EXPECT_TRUE(cache.Get(path, second, errors));
+    const std::vector<sdf::PolicyCondition> replayed = recorder.Conditions();
+    ASSERT_EQ(2u, replayed.size());
+    EXPECT_EQ(sdf::EnforcementPolicy::LOG, replayed[1].policy);
+    EXPECT_EQ("printed", replayed[1].error.Message());
+  }
+  EXPECT_EQ(2u, cache.HitCount());
+  ASSERT_EQ(2u, errors.size());
+  EXPECT_EQ(sdf::ErrorCode::WARNING, errors[0].Code());
+
+  ASSERT_NE(nullptr, first->Root());
+  EXPECT_NE(sdf->Root(), first->Root());
+  EXPECT_NE(first->Root(), second->Root());
+  EXPECT_EQ(sdf->Root()->ToString(""), first->Root()->ToString(""));
+  EXPECT_EQ(sdf->FilePath(), first->FilePath());
+  EXPECT_EQ(sdf->OriginalVersion(), first->OriginalVersion());
+
+  first->Root()->GetElement("model")->GetAttribute("name")->SetFromString(
+      "renamed");
+  EXPECT_EQ("model",
+      second->Root()->GetElement("model")->Get<std::string>("name"));
+
+  // A modified file is read again
+  std::filesystem::last_write_time(path,
+      std::filesystem::last_write_time(path) + std::chrono::seconds(10));
+  sdf::SDFPtr third(new sdf::SDF());
+  EXPECT_FALSE(cache.Get(path, third, errors));
+  EXPECT_EQ(2u, cache.HitCount());
+
+  // Files that do not exist are never cached
+  EXPECT_FALSE(cache.Get(path + ".missing", third, errors));
+  cache.Insert(path + ".missing", sdf, {}, {});
+  EXPECT_EQ(1u, cache.Size());
+
+  std::filesystem::remove(path);
+}
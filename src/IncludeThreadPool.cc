@@ -0,0 +1,153 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "IncludeThreadPool.hh"
+
+using namespace sdf;
+
+/////////////////////////////////////////////////
+/// \brief Pool of the load in progress on the calling thread.
+static IncludeThreadPool *&activePool()
+{
+  static thread_local IncludeThreadPool *pool = nullptr;
+  return pool;
+}
+
+/////////////////////////////////////////////////
+IncludeThreadPool::IncludeThreadPool(unsigned int _threadCount)
+  : threadCount(_threadCount)
+{
+}
+
+/////////////////////////////////////////////////
+IncludeThreadPool::~IncludeThreadPool()
+{
+  this->Wait([this]()
+  {
+    return this->tasks.empty();
+  });
+
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stop = true;
+  }
+  this->condition.notify_all();
+
+  for (auto &thread : this->threads)
+    thread.join();
+}
+
+/////////////////////////////////////////////////
+void IncludeThreadPool::Submit(std::function<void()> _task)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->tasks.push_back(std::move(_task));
+    if (this->threads.empty())
+    {
+      for (unsigned int i = 0; i < this->threadCount; ++i)
+        this->threads.emplace_back(&IncludeThreadPool::Work, this);
+    }
+  }
+  this->condition.notify_all();
+}
+
+/////////////////////////////////////////////////
+void IncludeThreadPool::Wait(const std::function<bool()> &_done)
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (!_done())
+  {
+    if (this->tasks.empty())
+    {
+      this->condition.wait(lock);
+      continue;
+    }
+
+    std::function<void()> task = std::move(this->tasks.front());
+    this->tasks.pop_front();
+    lock.unlock();
+    task();
+    lock.lock();
+    this->condition.notify_all();
+  }
+}
+
+/////////////////////////////////////////////////
+std::size_t IncludeThreadPool::ThreadCount() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->threads.size();
+}
+
+/////////////////////////////////////////////////
+IncludeThreadPool *IncludeThreadPool::Active()
+{
+  return activePool();
+}
+
+/////////////////////////////////////////////////
+void IncludeThreadPool::Work()
+{
+  // Tasks that read included files find the pool to submit the files they
+  // include.
+  activePool() = this;
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->condition.wait(lock, [this]()
+    {
+      return this->stop || !this->tasks.empty();
+    });
+    if (this->tasks.empty())
+      return;
+
+    std::function<void()> task = std::move(this->tasks.front());
+    this->tasks.pop_front();
+    lock.unlock();
+    task();
+    lock.lock();
+    this->condition.notify_all();
+  }
+}
+
+/////////////////////////////////////////////////
+IncludeThreadPoolScope::IncludeThreadPoolScope(const ParserConfig &_config)
+  : previous(activePool())
+{
+  // The thread that loads the document runs tasks while it waits for them,
+  // so it is one of the threads that read the included files.
+  if (_config.IncludeThreadCount() > 1 && !this->previous)
+  {
+    this->pool = std::make_unique<IncludeThreadPool>(
+        _config.IncludeThreadCount() - 1);
+    activePool() = this->pool.get();
+  }
+}
+
+/////////////////////////////////////////////////
+IncludeThreadPoolScope::~IncludeThreadPoolScope()
+{
+  this->pool.reset();
+  activePool() = this->previous;
+}
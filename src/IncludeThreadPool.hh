@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef SDF_INCLUDETHREADPOOL_HH_
+#define SDF_INCLUDETHREADPOOL_HH_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sdf/ParserConfig.hh"
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Threads that read the files of <include> elements while a
+  /// document is loaded, as configured by ParserConfig::IncludeThreadCount.
+  ///
+  /// One pool is created per load, by IncludeThreadPoolScope, and its
+  /// threads are started when the first task is submitted. The threads of
+  /// the pool and the threads that wait for tasks run the queued tasks, so
+  /// a task can submit more tasks and wait for them, e.g. to read the files
+  /// included by an included file, without blocking the pool.
+  class IncludeThreadPool
+  {
+    /// \brief Constructor.
+    /// \param[in] _threadCount Number of threads to start, in addition to
+    /// the threads that wait for tasks.
+    public: explicit IncludeThreadPool(unsigned int _threadCount);
+
+    /// \brief Destructor. Runs the remaining tasks and joins the threads.
+    public: ~IncludeThreadPool();
+
+    /// \brief Pools can not be copied.
+    public: IncludeThreadPool(const IncludeThreadPool &) = delete;
+
+    /// \brief Pools can not be copied.
+    public: IncludeThreadPool &operator=(const IncludeThreadPool &) = delete;
+
+    /// \brief Queue a task. Tasks must not throw.
+    /// \param[in] _task The task.
+    public: void Submit(std::function<void()> _task);
+
+    /// \brief Run queued tasks on the calling thread until a condition is
+    /// met. The condition is checked each time a task finishes.
+    /// \param[in] _done The condition.
+    public: void Wait(const std::function<bool()> &_done);
+
+    /// \brief Get the number of threads started by the pool.
+    /// \return Number of threads.
+    public: std::size_t ThreadCount() const;
+
+    /// \brief Get the pool of the load in progress on the calling thread.
+    /// \return The active pool, or nullptr if included files are read one
+    /// at a time.
+    public: static IncludeThreadPool *Active();
+
+    /// \brief Run the queued tasks until the pool is destroyed.
+    private: void Work();
+
+    /// \brief Number of threads to start.
+    private: unsigned int threadCount;
+
+    /// \brief Threads of the pool.
+    private: std::vector<std::thread> threads;
+
+    /// \brief Queued tasks, in the order they were submitted.
+    private: std::deque<std::function<void()>> tasks;
+
+    /// \brief True when the threads should stop.
+    private: bool stop = false;
+
+    /// \brief Mutex that protects the tasks and the threads.
+    private: mutable std::mutex mutex;
+
+    /// \brief Notified when a task is submitted or finishes.
+    private: std::condition_variable condition;
+  };
+
+  /// \internal
+  /// \brief Activate a thread pool for the calling thread while the parser
+  /// loads a document. Scopes can be nested, e.g. while reading included
+  /// files, in which case the pool of the outermost scope is used. The
+  /// previously active pool is restored when the scope ends.
+  class IncludeThreadPoolScope
+  {
+    /// \brief Constructor. Creates and activates a new pool if the
+    /// configuration reads included files with several threads and no pool
+    /// is active yet.
+    /// \param[in] _config Parser configuration.
+    public: explicit IncludeThreadPoolScope(const ParserConfig &_config);
+
+    /// \brief Destructor. Restores the previously active pool.
+    public: ~IncludeThreadPoolScope();
+
+    /// \brief Scopes can not be copied.
+    public: IncludeThreadPoolScope(const IncludeThreadPoolScope &) = delete;
+
+    /// \brief Scopes can not be copied.
+    public: IncludeThreadPoolScope &operator=(
+        const IncludeThreadPoolScope &) = delete;
+
+    /// \brief Pool created by this scope, if any.
+    private: std::unique_ptr<IncludeThreadPool> pool;
+
+    /// \brief Pool that was active before this scope.
+    private: IncludeThreadPool *previous;
+  };
+  }
+}
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "sdf/ParserConfig.hh"
+#include "IncludeThreadPool.hh"
+
+/////////////////////////////////////////////////
+TEST(IncludeThreadPool, Scope)
+{
+  sdf::ParserConfig config;
+  {
+    sdf::IncludeThreadPoolScope scope(config);
+    EXPECT_EQ(nullptr, sdf::IncludeThreadPool::Active());
+  }
+
+  config.SetIncludeThreadCount(4);
+  {
+    sdf::IncludeThreadPoolScope scope(config);
+    sdf::IncludeThreadPool *pool = sdf::IncludeThreadPool::Active();
+    ASSERT_NE(nullptr, pool);
+
+    // Threads are started by the first task
+    EXPECT_EQ(0u, pool->ThreadCount());
+
+    // Nested scopes, e.g. of included files, use the same pool
+    {
+      sdf::IncludeThreadPoolScope nestedScope(config);
+      EXPECT_EQ(pool, sdf::IncludeThreadPool::Active());
+    }
+    EXPECT_EQ(pool, sdf::IncludeThreadPool::Active());
+  }
+  EXPECT_EQ(nullptr, sdf::IncludeThreadPool::Active());
+}
+
+/////////////////////////////////////////////////
+TEST(IncludeThreadPool, Submit)
+{
+  sdf::IncludeThreadPool pool(3);
+  std::atomic<std::size_t> done{0};
+  std::mutex mutex;
+  std::set<std::thread::id> threadIds;
+  const std::thread::id waitingThreadId = std::this_thread::get_id();
+  for (int i = 0; i < 100; ++i)
+  {
+    pool.Submit([&]()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        threadIds.insert(std::this_thread::get_id());
+      }
+      // The threads of the pool submit the files they include to it
+      if (std::this_thread::get_id() != waitingThreadId)
+        EXPECT_EQ(&pool, sdf::IncludeThreadPool::Active());
+      ++done;
+    });
+  }
+  pool.Wait([&]()
+  {
+    return done == 100;
+  });
+
+  EXPECT_EQ(100u, done);
+  EXPECT_EQ(3u, pool.ThreadCount());
+  EXPECT_LE(threadIds.size(), 4u);
+}
+
+/////////////////////////////////////////////////
+TEST(IncludeThreadPool, NestedTasks)
+{
+  // Tasks that wait for their own tasks run queued tasks meanwhile, so
+  // nesting deeper than the number of threads does not block the pool.
+  sdf::IncludeThreadPool pool(1);
+  std::atomic<std::size_t> done{0};
+  std::function<void(int)> task = [&](int _depth)
+  {
+    if (_depth > 0)
+    {
+      std::atomic<std::size_t> pending{2};
+      for (int i = 0; i < 2; ++i)
+      {
+        pool.Submit([&]()
+        {
+          task(_depth - 1);
+          --pending;
+        });
+      }
+      pool.Wait([&]()
+      {
+        return pending == 0;
+      });
+    }
+    ++done;
+  };
+
+  task(5);
+  EXPECT_EQ(63u, done);
+}
+
+/////////////////////////////////////////////////
+TEST(IncludeThreadPool, Destructor)
+{
+  // Queued tasks are run before the threads are joined
+  std::atomic<std::size_t> done{0};
+  {
+    sdf::IncludeThreadPool pool(2);
+    for (int i = 0; i < 20; ++i)
+    {
+      pool.Submit([&]()
+      {
+        ++done;
+      });
+    }
+  }
+  EXPECT_EQ(20u, done);
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "sdf/InternedString.hh"
+
+using namespace sdf;
+
+namespace
+{
+/// \brief Shard of the pool of interned strings. Entries are weak, so a
+/// string is removed from its shard when its last handle is destroyed.
+class StringPoolShard
+{
+  /// \brief Get the pooled copy of a string.
+  /// \param[in] _value String to intern.
+  /// \return Pooled copy of the string.
+  public: std::shared_ptr<const std::string> Intern(const std::string &_value)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    auto iter = this->strings.find(_value);
+    if (iter != this->strings.end())
+    {
+      if (auto pooled = iter->second.lock())
+        return pooled;
+
+      // The last handle of the pooled string is being destroyed, but its
+      // deleter has not removed it from the pool yet.
+      this->strings.erase(iter);
+    }
+
+    std::shared_ptr<const std::string> pooled(new std::string(_value),
+        [this](const std::string *_str)
+        {
+          this->Release(_str);
+        });
+    this->strings.emplace(*pooled, pooled);
+    return pooled;
+  }
+
+  /// \brief Remove a string whose last handle was destroyed from the pool,
+  /// and delete it.
+  /// \param[in] _str String to release.
+  public: void Release(const std::string *_str)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      auto iter = this->strings.find(*_str);
+      if (iter != this->strings.end() && iter->first.data() == _str->data())
+        this->strings.erase(iter);
+    }
+    delete _str;
+  }
+
+  /// \brief Get the number of strings in the shard.
+  /// \return Number of pooled strings.
+  public: std::size_t Size()
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->strings.size();
+  }
+
+  /// \brief Mutex to protect the shard.
+  private: std::mutex mutex;
+
+  /// \brief Pooled strings, keyed by views of themselves.
+  private: std::unordered_map<std::string_view,
+                              std::weak_ptr<const std::string>> strings;
+};
+
+/// \brief Number of shards of the pool. Strings are spread over the shards
+/// by hash, so that threads parsing in parallel rarely wait for each other.
+constexpr std::size_t kPoolShardCount = 16;
+
+/////////////////////////////////////////////////
+/// \brief Get the shards of the process-wide string pool. They are never
+/// destroyed, since static handles may outlive any other static object.
+StringPoolShard *poolShards()
+{
+  static StringPoolShard *shards = new StringPoolShard[kPoolShardCount];
+  return shards;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the shard of the pool that holds a string.
+/// \param[in] _value The string.
+/// \return The shard.
+StringPoolShard &poolShard(const std::string &_value)
+{
+  return poolShards()[std::hash<std::string>()(_value) % kPoolShardCount];
+}
+
+/////////////////////////////////////////////////
+/// \brief The empty string, which is not pooled.
+const std::string &emptyString()
+{
+  static const std::string *empty = new std::string;
+  return *empty;
+}
+}
+
+/////////////////////////////////////////////////
+InternedString::InternedString(const std::string &_value)
+{
+  *this = _value;
+}
+
+/////////////////////////////////////////////////
+InternedString &InternedString::operator=(const std::string &_value)
+{
+  if (_value.empty())
+    this->value.reset();
+  else if (!this->value || *this->value != _value)
+    this->value = poolShard(_value).Intern(_value);
+  return *this;
+}
+
+/////////////////////////////////////////////////
+const std::string &InternedString::String() const
+{
+  return this->value ? *this->value : emptyString();
+}
+
+/////////////////////////////////////////////////
+InternedString::operator const std::string &() const
+{
+  return this->String();
+}
+
+/////////////////////////////////////////////////
+bool InternedString::Empty() const
+{
+  return !this->value;
+}
+
+/////////////////////////////////////////////////
+void InternedString::Clear()
+{
+  this->value.reset();
+}
+
+/////////////////////////////////////////////////
+std::size_t InternedString::PoolSize()
+{
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < kPoolShardCount; ++i)
+    size += poolShards()[i].Size();
+  return size;
+}
+
+/////////////////////////////////////////////////
+bool sdf::operator==(const InternedString &_a, const InternedString &_b)
+{
+  // Equal strings share the same pooled copy
+  return &_a.String() == &_b.String();
+}
+
+/////////////////////////////////////////////////
+bool sdf::operator==(const InternedString &_a, const std::string &_b)
+{
+  return _a.String() == _b;
+}
+
+/////////////////////////////////////////////////
+bool sdf::operator==(const std::string &_a, const InternedString &_b)
+{
+  return _a == _b.String();
+}
+
+/////////////////////////////////////////////////
+bool sdf::operator!=(const InternedString &_a, const InternedString &_b)
+{
+  return !(_a == _b);
+}
+
+/////////////////////////////////////////////////
+bool sdf::operator!=(const InternedString &_a, const std::string &_b)
+{
+  return !(_a == _b);
+}
+
+/////////////////////////////////////////////////
+bool sdf::operator!=(const std::string &_a, const InternedString &_b)
+{
+  return !(_a == _b);
+}
+
+/////////////////////////////////////////////////
+std::ostream &sdf::operator<<(std::ostream &_out, const InternedString &_str)
+{
+  return _out << _str.String();
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/InternedString.hh"
+
+/////////////////////////////////////////////////
+TEST(InternedString, Construction)
+{
+  sdf::InternedString empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ("", empty.String());
+
+  sdf::InternedString str(std::string("interned_string_construction"));
+  EXPECT_FALSE(str.Empty());
+  EXPECT_EQ("interned_string_construction", str.String());
+
+  const std::string &ref = str;
+  EXPECT_EQ(&str.String(), &ref);
+
+  std::ostringstream stream;
+  stream << str;
+  EXPECT_EQ("interned_string_construction", stream.str());
+
+  str.Clear();
+  EXPECT_TRUE(str.Empty());
+  EXPECT_EQ(empty, str);
+}
+
+/////////////////////////////////////////////////
+TEST(InternedString, Sharing)
+{
+  const std::size_t poolSize = sdf::InternedString::PoolSize();
+  {
+    sdf::InternedString first(std::string("interned_string_sharing"));
+    sdf::InternedString second;
+    second = std::string("interned_string_sharing");
+    sdf::InternedString copy = first;
+
+    // Equal strings share one pooled copy
+    EXPECT_EQ(&first.String(), &second.String());
+    EXPECT_EQ(&first.String(), &copy.String());
+    EXPECT_EQ(poolSize + 1, sdf::InternedString::PoolSize());
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first, std::string("interned_string_sharing"));
+    EXPECT_EQ(std::string("interned_string_sharing"), first);
+    EXPECT_NE(first, std::string("other"));
+
+    second = std::string("interned_string_sharing_other");
+    EXPECT_NE(first, second);
+    EXPECT_EQ(poolSize + 2, sdf::InternedString::PoolSize());
+  }
+
+  // Strings are released with their last handle
+  EXPECT_EQ(poolSize, sdf::InternedString::PoolSize());
+}
+
+/////////////////////////////////////////////////
+TEST(InternedString, ElementMetadata)
+{
+  sdf::ElementPtr parent = std::make_shared<sdf::Element>();
+  parent->SetName("interned_string_parent");
+  parent->SetFilePath("/path/to/interned_string.sdf");
+  parent->SetDescription("Interned string description");
+
+  sdf::ElementPtr child = std::make_shared<sdf::Element>();
+  child->SetParent(parent);
+  EXPECT_EQ(&parent->FilePath(), &child->FilePath());
+
+  sdf::ElementPtr clone = parent->Clone();
+  EXPECT_EQ(&parent->GetName(), &clone->GetName());
+  EXPECT_EQ(&parent->FilePath(), &clone->FilePath());
+  EXPECT_EQ("Interned string description", clone->GetDescription());
+
+  clone->SetName("interned_string_clone");
+  EXPECT_EQ("interned_string_parent", parent->GetName());
+  EXPECT_EQ("interned_string_clone", clone->GetName());
+}
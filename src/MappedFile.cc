@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.hh"
+
+using namespace sdf;
+
+/////////////////////////////////////////////////
+MappedFile::MappedFile(const std::string &_path)
+{
+#ifndef _WIN32
+  const int fd = ::open(_path.c_str(), O_RDONLY);
+  if (fd >= 0)
+  {
+    struct stat status;
+    if (::fstat(fd, &status) == 0 && S_ISREG(status.st_mode) &&
+        status.st_size > 0)
+    {
+      void *start = ::mmap(nullptr, static_cast<std::size_t>(status.st_size),
+                           PROT_READ, MAP_PRIVATE, fd, 0);
+      if (start != MAP_FAILED)
+      {
+        this->mapping = start;
+        this->mappingSize = static_cast<std::size_t>(status.st_size);
+        this->data = std::string_view(static_cast<const char *>(start),
+                                      this->mappingSize);
+        this->valid = true;
+      }
+    }
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+    if (this->valid)
+      return;
+  }
+#endif
+
+  // Empty files, files that are not regular files and platforms without
+  // mmap are read into a buffer instead.
+  std::ifstream file(_path, std::ios::binary);
+  if (!file)
+    return;
+
+  this->buffer.assign(std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>());
+  if (file.bad())
+  {
+    this->buffer.clear();
+    return;
+  }
+  this->data = this->buffer;
+  this->valid = true;
+}
+
+/////////////////////////////////////////////////
+MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+  if (this->mapping)
+    ::munmap(this->mapping, this->mappingSize);
+#endif
+}
+
+/////////////////////////////////////////////////
+bool MappedFile::Valid() const
+{
+  return this->valid;
+}
+
+/////////////////////////////////////////////////
+bool MappedFile::Mapped() const
+{
+  return this->mapping != nullptr;
+}
+
+/////////////////////////////////////////////////
+std::string_view MappedFile::Data() const
+{
+  return this->data;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_MAPPEDFILE_HH_
+#define SDF_MAPPEDFILE_HH_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Read-only view of the contents of a file. The file is mapped
+  /// into memory where the platform supports it, so that the streaming
+  /// reader (ParserConfig::SetStreamingParsing) can parse it in place,
+  /// without a copy of the whole file on the heap. Otherwise, or if the
+  /// file cannot be mapped, it is read into a buffer owned by this object.
+  class MappedFile
+  {
+    /// \brief Constructor. Maps or reads the file.
+    /// \param[in] _path Path of the file.
+    public: explicit MappedFile(const std::string &_path);
+
+    /// \brief Destructor. Unmaps the file.
+    public: ~MappedFile();
+
+    /// \brief Copy constructor is deleted, the mapping has a single owner.
+    public: MappedFile(const MappedFile &) = delete;
+
+    /// \brief Copy assignment is deleted, the mapping has a single owner.
+    public: MappedFile &operator=(const MappedFile &) = delete;
+
+    /// \brief Get whether the file could be read.
+    /// \return True if the file was mapped or read.
+    public: bool Valid() const;
+
+    /// \brief Get whether the file is mapped into memory, rather than read
+    /// into a buffer.
+    /// \return True if the file is mapped.
+    public: bool Mapped() const;
+
+    /// \brief Get the contents of the file. The view is valid as long as
+    /// this object exists. It is not null terminated.
+    /// \return Contents of the file, empty if it could not be read.
+    public: std::string_view Data() const;
+
+    /// \brief Start of the mapping, or nullptr if the file is not mapped.
+    private: void *mapping = nullptr;
+
+    /// \brief Size of the mapping.
+    private: std::size_t mappingSize = 0;
+
+    /// \brief Contents of the file, if it could not be mapped.
+    private: std::string buffer;
+
+    /// \brief Contents of the file.
+    private: std::string_view data;
+
+    /// \brief True if the file was mapped or read.
+    private: bool valid = false;
+  };
+  }
+}
+#endif
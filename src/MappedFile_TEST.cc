@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Filesystem.hh"
+#include "MappedFile.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+TEST(MappedFile, Data)
+{
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string path =
+      sdf::filesystem::append(tmpDir, "mapped_file.sdf");
+  const std::string contents =
+      "<sdf version='1.11'>\r\n<model name='model'/></sdf>";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+  }
+
+  {
+    sdf::MappedFile file(path);
+    EXPECT_TRUE(file.Valid());
+#ifndef _WIN32
+    EXPECT_TRUE(file.Mapped());
+#endif
+    EXPECT_EQ(contents, file.Data());
+  }
+
+  // Empty files are valid, and have no contents
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  }
+  {
+    sdf::MappedFile file(path);
+    EXPECT_TRUE(file.Valid());
+    EXPECT_FALSE(file.Mapped());
+    EXPECT_TRUE(file.Data().empty());
+  }
+
+  std::filesystem::remove(path);
+
+  sdf::MappedFile missing(path);
+  EXPECT_FALSE(missing.Valid());
+  EXPECT_FALSE(missing.Mapped());
+  EXPECT_TRUE(missing.Data().empty());
+}
@@ -16,6 +16,7 @@
 */
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 #include <gz/math/Pose3.hh>
@@ -33,6 +34,7 @@
 #include "sdf/ParserConfig.hh"
 #include "sdf/Types.hh"
 #include "FrameSemantics.hh"
+#include "NameIndex.hh"
 #include "ScopedGraph.hh"
 #include "Utils.hh"
 #include "sdf/parser.hh"
@@ -81,6 +83,18 @@ class sdf::Model::Implementation
   /// \brief The nested models specified in this model.
   public: std::vector<Model> models;
 
+  /// \brief Index of the links by name.
+  public: NameIndex<Link> linkIndex;
+
+  /// \brief Index of the joints by name.
+  public: NameIndex<Joint> jointIndex;
+
+  /// \brief Index of the explicit frames by name.
+  public: NameIndex<Frame> frameIndex;
+
+  /// \brief Index of the nested models by name.
+  public: NameIndex<Model> modelIndex;
+
   /// \brief The interface models specified in this model.
   public: std::vector<std::pair<std::optional<sdf::NestedInclude>,
           sdf::InterfaceModelConstPtr>> interfaceModels;
@@ -497,6 +511,13 @@ Errors Model::Load(sdf::ElementPtr _sdf, const ParserConfig &_config)
                      "A model must have at least one link."});
   }
 
+  // Index the children by name. This is done once they are all loaded, since
+  // merged models move their children into this model.
+  this->dataPtr->linkIndex.Rebuild(this->dataPtr->links);
+  this->dataPtr->jointIndex.Rebuild(this->dataPtr->joints);
+  this->dataPtr->frameIndex.Rebuild(this->dataPtr->frames);
+  this->dataPtr->modelIndex.Rebuild(this->dataPtr->models);
+
   // Check whether the model was loaded from an <include> tag. If so, set
   // the URI and capture the plugins.
   if (_sdf->GetIncludeElement() && _sdf->GetIncludeElement()->HasElement("uri"))
@@ -601,8 +622,10 @@ const Link *Model::LinkByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Link *Model::LinkByIndex(uint64_t _index)
 {
-  return const_cast<Link*>(
-      static_cast<const Model*>(this)->LinkByIndex(_index));
+  if (_index >= this->dataPtr->links.size())
+    return nullptr;
+  this->dataPtr->linkIndex.MarkMutable(_index);
+  return &this->dataPtr->links[_index];
 }
 
 /////////////////////////////////////////////////
@@ -628,8 +651,10 @@ const Joint *Model::JointByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Joint *Model::JointByIndex(uint64_t _index)
 {
-  return const_cast<Joint*>(
-      static_cast<const Model*>(this)->JointByIndex(_index));
+  if (_index >= this->dataPtr->joints.size())
+    return nullptr;
+  this->dataPtr->jointIndex.MarkMutable(_index);
+  return &this->dataPtr->joints[_index];
 }
 
 /////////////////////////////////////////////////
@@ -640,14 +665,20 @@ bool Model::JointNameExists(const std::string &_name) const
 
 /////////////////////////////////////////////////
 const Joint *Model::JointByName(const std::string &_name) const
+{
+  return this->JointByNameView(_name);
+}
+
+/////////////////////////////////////////////////
+const Joint *Model::JointByNameView(std::string_view _name) const
 {
   auto index = _name.rfind("::");
-  if (index != std::string::npos)
+  if (index != std::string_view::npos)
   {
-    const Model *model = this->ModelByName(_name.substr(0, index));
+    const Model *model = this->ModelByNameView(_name.substr(0, index));
     if (nullptr != model)
     {
-      return model->JointByName(_name.substr(index + 2));
+      return model->JointByNameView(_name.substr(index + 2));
     }
 
     // The nested model name preceding the last "::" could not be found.
@@ -657,22 +688,24 @@ const Joint *Model::JointByName(const std::string &_name) const
     // return nullptr;
   }
 
-  for (auto const &j : this->dataPtr->joints)
-  {
-    if (j.Name() == _name)
-    {
-      return &j;
-    }
-  }
-  return nullptr;
-
+  return this->dataPtr->jointIndex.Find(this->dataPtr->joints, _name);
 }
 
 /////////////////////////////////////////////////
 Joint *Model::JointByName(const std::string &_name)
 {
-  return const_cast<Joint*>(
-      static_cast<const Model*>(this)->JointByName(_name));
+  // The joint is marked as mutable in the index of the model that holds
+  // it, so the nested models are followed through mutable pointers.
+  auto index = _name.rfind("::");
+  if (index != std::string::npos)
+  {
+    Model *model = this->ModelByName(_name.substr(0, index));
+    if (nullptr != model)
+    {
+      return model->JointByName(_name.substr(index + 2));
+    }
+  }
+  return this->dataPtr->jointIndex.FindMutable(this->dataPtr->joints, _name);
 }
 
 /////////////////////////////////////////////////
@@ -692,8 +725,10 @@ const Frame *Model::FrameByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Frame *Model::FrameByIndex(uint64_t _index)
 {
-  return const_cast<Frame*>(
-      static_cast<const Model*>(this)->FrameByIndex(_index));
+  if (_index >= this->dataPtr->frames.size())
+    return nullptr;
+  this->dataPtr->frameIndex.MarkMutable(_index);
+  return &this->dataPtr->frames[_index];
 }
 
 /////////////////////////////////////////////////
@@ -704,14 +739,20 @@ bool Model::FrameNameExists(const std::string &_name) const
 
 /////////////////////////////////////////////////
 const Frame *Model::FrameByName(const std::string &_name) const
+{
+  return this->FrameByNameView(_name);
+}
+
+/////////////////////////////////////////////////
+const Frame *Model::FrameByNameView(std::string_view _name) const
 {
   auto index = _name.rfind("::");
-  if (index != std::string::npos)
+  if (index != std::string_view::npos)
   {
-    const Model *model = this->ModelByName(_name.substr(0, index));
+    const Model *model = this->ModelByNameView(_name.substr(0, index));
     if (nullptr != model)
     {
-      return model->FrameByName(_name.substr(index + 2));
+      return model->FrameByNameView(_name.substr(index + 2));
     }
 
     // The nested model name preceding the last "::" could not be found.
@@ -721,21 +762,24 @@ const Frame *Model::FrameByName(const std::string &_name) const
     // return nullptr;
   }
 
-  for (auto const &f : this->dataPtr->frames)
-  {
-    if (f.Name() == _name)
-    {
-      return &f;
-    }
-  }
-  return nullptr;
+  return this->dataPtr->frameIndex.Find(this->dataPtr->frames, _name);
 }
 
 /////////////////////////////////////////////////
 Frame *Model::FrameByName(const std::string &_name)
 {
-  return const_cast<Frame*>(
-      static_cast<const Model*>(this)->FrameByName(_name));
+  // The frame is marked as mutable in the index of the model that holds
+  // it, so the nested models are followed through mutable pointers.
+  auto index = _name.rfind("::");
+  if (index != std::string::npos)
+  {
+    Model *model = this->ModelByName(_name.substr(0, index));
+    if (nullptr != model)
+    {
+      return model->FrameByName(_name.substr(index + 2));
+    }
+  }
+  return this->dataPtr->frameIndex.FindMutable(this->dataPtr->frames, _name);
 }
 
 /////////////////////////////////////////////////
@@ -755,8 +799,10 @@ const Model *Model::ModelByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Model *Model::ModelByIndex(uint64_t _index)
 {
-  return const_cast<Model*>(
-      static_cast<const Model*>(this)->ModelByIndex(_index));
+  if (_index >= this->dataPtr->models.size())
+    return nullptr;
+  this->dataPtr->modelIndex.MarkMutable(_index);
+  return &this->dataPtr->models[_index];
 }
 
 /////////////////////////////////////////////////
@@ -768,32 +814,37 @@ bool Model::ModelNameExists(const std::string &_name) const
 /////////////////////////////////////////////////
 const Model *Model::ModelByName(const std::string &_name) const
 {
-  auto index = _name.find("::");
-  const std::string nextModelName = _name.substr(0, index);
-  const Model *nextModel = nullptr;
+  return this->ModelByNameView(_name);
+}
 
-  for (auto const &m : this->dataPtr->models)
-  {
-    if (m.Name() == nextModelName)
-    {
-      nextModel = &m;
-      break;
-    }
-  }
+/////////////////////////////////////////////////
+const Model *Model::ModelByNameView(std::string_view _name) const
+{
+  auto index = _name.find("::");
+  const Model *nextModel = this->dataPtr->modelIndex.Find(
+      this->dataPtr->models, _name.substr(0, index));
 
-  if (nullptr != nextModel && index != std::string::npos)
+  if (nullptr != nextModel && index != std::string_view::npos)
   {
-    return nextModel->ModelByName(_name.substr(index + 2));
+    return nextModel->ModelByNameView(_name.substr(index + 2));
   }
   return nextModel;
-
 }
 
 /////////////////////////////////////////////////
 Model *Model::ModelByName(const std::string &_name)
 {
-  return const_cast<Model*>(
-      static_cast<const Model*>(this)->ModelByName(_name));
+  // The nested model is marked as mutable in the index of the model that
+  // holds it, so the nested models are followed through mutable pointers.
+  auto index = _name.rfind("::");
+  if (index != std::string::npos)
+  {
+    Model *model = this->ModelByName(_name.substr(0, index));
+    if (nullptr == model)
+      return nullptr;
+    return model->ModelByName(_name.substr(index + 2));
+  }
+  return this->dataPtr->modelIndex.FindMutable(this->dataPtr->models, _name);
 }
 
 /////////////////////////////////////////////////
@@ -998,14 +1049,20 @@ sdf::SemanticPose Model::SemanticPose() const
 
 /////////////////////////////////////////////////
 const Link *Model::LinkByName(const std::string &_name) const
+{
+  return this->LinkByNameView(_name);
+}
+
+/////////////////////////////////////////////////
+const Link *Model::LinkByNameView(std::string_view _name) const
 {
   auto index = _name.rfind("::");
-  if (index != std::string::npos)
+  if (index != std::string_view::npos)
   {
-    const Model *model = this->ModelByName(_name.substr(0, index));
+    const Model *model = this->ModelByNameView(_name.substr(0, index));
     if (nullptr != model)
     {
-      return model->LinkByName(_name.substr(index + 2));
+      return model->LinkByNameView(_name.substr(index + 2));
     }
 
     // The nested model name preceding the last "::" could not be found.
@@ -1015,22 +1072,24 @@ const Link *Model::LinkByName(const std::string &_name) const
     // return nullptr;
   }
 
-  for (auto const &l : this->dataPtr->links)
-  {
-    if (l.Name() == _name)
-    {
-      return &l;
-    }
-  }
-  return nullptr;
-
+  return this->dataPtr->linkIndex.Find(this->dataPtr->links, _name);
 }
 
 /////////////////////////////////////////////////
 Link *Model::LinkByName(const std::string &_name)
 {
-  return const_cast<Link*>(
-      static_cast<const Model*>(this)->LinkByName(_name));
+  // The link is marked as mutable in the index of the model that holds
+  // it, so the nested models are followed through mutable pointers.
+  auto index = _name.rfind("::");
+  if (index != std::string::npos)
+  {
+    Model *model = this->ModelByName(_name.substr(0, index));
+    if (nullptr != model)
+    {
+      return model->LinkByName(_name.substr(index + 2));
+    }
+  }
+  return this->dataPtr->linkIndex.FindMutable(this->dataPtr->links, _name);
 }
 
 /////////////////////////////////////////////////
@@ -1172,6 +1231,7 @@ bool Model::AddLink(const Link &_link)
   if (this->LinkNameExists(_link.Name()))
     return false;
   this->dataPtr->links.push_back(_link);
+  this->dataPtr->linkIndex.Add(this->dataPtr->links);
   return true;
 }
 
@@ -1181,6 +1241,7 @@ bool Model::AddJoint(const Joint &_joint)
   if (this->JointNameExists(_joint.Name()))
     return false;
   this->dataPtr->joints.push_back(_joint);
+  this->dataPtr->jointIndex.Add(this->dataPtr->joints);
   return true;
 }
 
@@ -1190,6 +1251,7 @@ bool Model::AddModel(const Model &_model)
   if (this->ModelNameExists(_model.Name()))
     return false;
   this->dataPtr->models.push_back(_model);
+  this->dataPtr->modelIndex.Add(this->dataPtr->models);
   return true;
 }
 
@@ -1197,18 +1259,21 @@ bool Model::AddModel(const Model &_model)
 void Model::ClearLinks()
 {
   this->dataPtr->links.clear();
+  this->dataPtr->linkIndex.Clear();
 }
 
 //////////////////////////////////////////////////
 void Model::ClearJoints()
 {
   this->dataPtr->joints.clear();
+  this->dataPtr->jointIndex.Clear();
 }
 
 //////////////////////////////////////////////////
 void Model::ClearModels()
 {
   this->dataPtr->models.clear();
+  this->dataPtr->modelIndex.Clear();
 }
 
 //////////////////////////////////////////////////
@@ -1217,6 +1282,7 @@ bool Model::AddFrame(const Frame &_frame)
   if (this->FrameNameExists(_frame.Name()))
     return false;
   this->dataPtr->frames.push_back(_frame);
+  this->dataPtr->frameIndex.Add(this->dataPtr->frames);
   return true;
 }
 
@@ -1224,6 +1290,7 @@ bool Model::AddFrame(const Frame &_frame)
 void Model::ClearFrames()
 {
   this->dataPtr->frames.clear();
+  this->dataPtr->frameIndex.Clear();
 }
 
 /////////////////////////////////////////////////
@@ -673,3 +673,111 @@ TEST(DOMModel, Plugins)
   model.ClearPlugins();
   EXPECT_TRUE(model.Plugins().empty());
 }
+
+/////////////////////////////////////////////////
+TEST(DOMModel, LookupByName)
+{
+  sdf::Model model;
+  model.SetName("model");
+
+  for (int i = 0; i < 100; ++i)
+  {
+    sdf::Link link;
+    link.SetName("link" + std::to_string(i));
+    EXPECT_TRUE(model.AddLink(link));
+
+    sdf::Joint joint;
+    joint.SetName("joint" + std::to_string(i));
+    EXPECT_TRUE(model.AddJoint(joint));
+
+    sdf::Frame frame;
+    frame.SetName("frame" + std::to_string(i));
+    EXPECT_TRUE(model.AddFrame(frame));
+  }
+
+  sdf::Model grandchild;
+  grandchild.SetName("grandchild");
+  sdf::Link grandchildLink;
+  grandchildLink.SetName("link");
+  EXPECT_TRUE(grandchild.AddLink(grandchildLink));
+
+  sdf::Model child;
+  child.SetName("child");
+  EXPECT_TRUE(child.AddModel(grandchild));
+  EXPECT_TRUE(model.AddModel(child));
+
+  for (int i = 0; i < 100; ++i)
+  {
+    const std::string suffix = std::to_string(i);
+    ASSERT_NE(nullptr, model.LinkByName("link" + suffix));
+    EXPECT_EQ(model.LinkByIndex(i), model.LinkByName("link" + suffix));
+    EXPECT_EQ(model.JointByIndex(i), model.JointByName("joint" + suffix));
+    EXPECT_EQ(model.FrameByIndex(i), model.FrameByName("frame" + suffix));
+  }
+  EXPECT_EQ(nullptr, model.LinkByName("link100"));
+
+  // Scoped names
+  ASSERT_NE(nullptr, model.ModelByName("child::grandchild"));
+  EXPECT_EQ(model.ModelByName("child")->ModelByIndex(0),
+            model.ModelByName("child::grandchild"));
+  ASSERT_NE(nullptr, model.LinkByName("child::grandchild::link"));
+  EXPECT_EQ("link", model.LinkByName("child::grandchild::link")->Name());
+  EXPECT_EQ(nullptr, model.LinkByName("child::link"));
+  EXPECT_EQ(nullptr, model.ModelByName("child::missing"));
+
+  // Cleared containers are removed from the index
+  model.ClearLinks();
+  EXPECT_EQ(nullptr, model.LinkByName("link0"));
+  sdf::Link link;
+  link.SetName("link1");
+  EXPECT_TRUE(model.AddLink(link));
+  EXPECT_EQ(model.LinkByIndex(0), model.LinkByName("link1"));
+
+  model.ClearModels();
+  EXPECT_EQ(nullptr, model.ModelByName("child::grandchild"));
+
+  // Copies have their own index
+  sdf::Model copy(model);
+  ASSERT_NE(nullptr, copy.JointByName("joint99"));
+  EXPECT_EQ(copy.JointByIndex(99), copy.JointByName("joint99"));
+
+  // Children renamed through mutable pointers are found by their new name,
+  // and the first child with a name is still the one that is found
+  copy.JointByIndex(3)->SetName("renamed");
+  EXPECT_EQ(nullptr, copy.JointByName("joint3"));
+  EXPECT_EQ(copy.JointByIndex(3), copy.JointByName("renamed"));
+  ASSERT_NE(nullptr, copy.FrameByName("frame1"));
+  copy.FrameByName("frame1")->SetName("frame2");
+  EXPECT_EQ(copy.FrameByIndex(1), copy.FrameByName("frame2"));
+  EXPECT_FALSE(copy.FrameNameExists("frame1"));
+
+  // Names added after a rename are checked against the new names
+  sdf::Joint joint;
+  joint.SetName("joint3");
+  EXPECT_TRUE(copy.AddJoint(joint));
+  joint.SetName("renamed");
+  EXPECT_FALSE(copy.AddJoint(joint));
+
+  // Nested children renamed through scoped names are found as well
+  EXPECT_TRUE(copy.AddModel(child));
+  ASSERT_NE(nullptr, copy.LinkByName("child::grandchild::link"));
+  copy.LinkByName("child::grandchild::link")->SetName("renamed_link");
+  EXPECT_EQ(nullptr, copy.LinkByName("child::grandchild::link"));
+  EXPECT_NE(nullptr, copy.LinkByName("child::grandchild::renamed_link"));
+  copy.ModelByName("child::grandchild")->SetName("renamed_model");
+  EXPECT_EQ(nullptr, copy.ModelByName("child::grandchild"));
+  EXPECT_NE(nullptr, copy.LinkByName("child::renamed_model::renamed_link"));
+
+  // A child renamed through a pointer kept across other lookups is found by
+  // its new name
+  link.SetName("link2");
+  EXPECT_TRUE(copy.AddLink(link));
+  sdf::Link *kept = copy.LinkByName("link1");
+  ASSERT_NE(nullptr, kept);
+  ASSERT_NE(nullptr, copy.LinkByName("link2"));
+  kept->SetName("link3");
+  EXPECT_EQ(kept, copy.LinkByName("link3"));
+  kept->SetName("link4");
+  EXPECT_EQ(kept, copy.LinkByName("link4"));
+  EXPECT_EQ(nullptr, copy.LinkByName("link3"));
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_NAMEINDEX_HH_
+#define SDF_NAMEINDEX_HH_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Hash index from the names of the items of a container, such as
+  /// the links of a model, to the position of the first item with each name.
+  /// It is used by the *ByName functions so that they do not scan the
+  /// container.
+  ///
+  /// Items can be renamed through the mutable pointers returned by their
+  /// container. The container reports the positions of those items with
+  /// MarkMutable. Since the pointers can be kept, every later lookup checks
+  /// whether those items were renamed, and rebuilds the index if so, until
+  /// the container is indexed again with Rebuild or emptied with Clear. A
+  /// container that was changed without going through Add, such as while it
+  /// is loaded, is indexed again when its size no longer matches the index.
+  ///
+  /// Lookups from several threads take no lock, unless the index has to be
+  /// checked or rebuilt, as long as the container is not changed meanwhile.
+  template <typename T>
+  class NameIndex
+  {
+    /// \brief Constructor.
+    public: NameIndex() = default;
+
+    /// \brief Copy constructor.
+    /// \param[in] _index The index to copy.
+    public: NameIndex(const NameIndex &_index)
+    {
+      *this = _index;
+    }
+
+    /// \brief Copy assignment operator.
+    /// \param[in] _index The index to copy.
+    /// \return Reference to this index.
+    public: NameIndex &operator=(const NameIndex &_index)
+    {
+      if (this != &_index)
+      {
+        std::scoped_lock lock(this->mutex, _index.mutex);
+        this->names = _index.names;
+        this->IndexNamesUnlocked();
+        this->mutablePositions = _index.mutablePositions;
+        this->marked = _index.marked;
+        this->hasMutablePositions.store(!this->mutablePositions.empty(),
+                                        std::memory_order_release);
+      }
+      return *this;
+    }
+
+    /// \brief Find the first item with a given name.
+    /// \param[in] _items Container the index was built for.
+    /// \param[in] _name Name of the item.
+    /// \return Pointer to the item, nullptr if no item has the name.
+    public: const T *Find(const std::vector<T> &_items,
+                          std::string_view _name) const
+    {
+      if (!this->hasMutablePositions.load(std::memory_order_acquire) &&
+          this->indexedSize.load(std::memory_order_acquire) == _items.size())
+      {
+        return this->FindUnlocked(_items, _name);
+      }
+
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->Update(_items);
+      return this->FindUnlocked(_items, _name);
+    }
+
+    /// \brief Find the first item with a given name, to be returned as a
+    /// mutable pointer. The item is marked with MarkMutable.
+    /// \param[in] _items Container the index was built for.
+    /// \param[in] _name Name of the item.
+    /// \return Pointer to the item, nullptr if no item has the name.
+    public: T *FindMutable(std::vector<T> &_items, std::string_view _name)
+    {
+      const T *item = this->Find(_items, _name);
+      if (nullptr == item)
+        return nullptr;
+      const std::size_t position = item - _items.data();
+      this->MarkMutable(position);
+      return &_items[position];
+    }
+
+    /// \brief Record that a mutable pointer to an item was handed out, so
+    /// that later lookups check whether the item was renamed.
+    /// \param[in] _position Position of the item in the container.
+    public: void MarkMutable(std::size_t _position)
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      if (_position >= this->marked.size())
+        this->marked.resize(_position + 1, false);
+      if (this->marked[_position])
+        return;
+      this->marked[_position] = true;
+      this->mutablePositions.push_back(_position);
+      this->hasMutablePositions.store(true, std::memory_order_release);
+    }
+
+    /// \brief Index the last item of a container, after it was appended.
+    /// \param[in] _items Container the index was built for.
+    public: void Add(const std::vector<T> &_items)
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      if (this->names.size() + 1 != _items.size())
+      {
+        this->RebuildUnlocked(_items);
+        return;
+      }
+      this->names.push_back(_items.back().Name());
+      this->positions.emplace(this->names.back(), _items.size() - 1);
+      this->indexedSize.store(this->names.size(), std::memory_order_release);
+    }
+
+    /// \brief Index all the items of a container again, and forget the
+    /// items marked as mutable.
+    /// \param[in] _items Container the index is built for.
+    public: void Rebuild(const std::vector<T> &_items)
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->ClearMutableUnlocked();
+      this->RebuildUnlocked(_items);
+    }
+
+    /// \brief Remove all the items from the index.
+    public: void Clear()
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->ClearMutableUnlocked();
+      this->names.clear();
+      this->positions.clear();
+      this->indexedSize.store(0, std::memory_order_release);
+    }
+
+    /// \brief Look up the index. The index must match the container.
+    /// \param[in] _items Container the index was built for.
+    /// \param[in] _name Name of the item.
+    /// \return Pointer to the item, nullptr if no item has the name.
+    private: const T *FindUnlocked(const std::vector<T> &_items,
+                                   std::string_view _name) const
+    {
+      const auto it = this->positions.find(_name);
+      if (it == this->positions.end())
+        return nullptr;
+      return &_items[it->second];
+    }
+
+    /// \brief Index the container again if it no longer matches the index.
+    /// The mutex must be locked.
+    /// \param[in] _items Container the index was built for.
+    private: void Update(const std::vector<T> &_items) const
+    {
+      bool renamed = this->names.size() != _items.size();
+      for (std::size_t i = 0; !renamed && i < this->mutablePositions.size();
+           ++i)
+      {
+        const std::size_t position = this->mutablePositions[i];
+        renamed = position < _items.size() &&
+            _items[position].Name() != this->names[position];
+      }
+      if (renamed)
+        this->RebuildUnlocked(_items);
+    }
+
+    /// \brief Index all the items of a container again. The items marked
+    /// as mutable stay marked, as long as they are in the container. The
+    /// mutex must be locked.
+    /// \param[in] _items Container the index is built for.
+    private: void RebuildUnlocked(const std::vector<T> &_items) const
+    {
+      this->names.clear();
+      for (const T &item : _items)
+        this->names.push_back(item.Name());
+      this->IndexNamesUnlocked();
+
+      if (this->marked.size() > _items.size())
+      {
+        this->marked.resize(_items.size());
+        this->mutablePositions.erase(
+            std::remove_if(this->mutablePositions.begin(),
+                           this->mutablePositions.end(),
+                           [&_items](std::size_t _position)
+                           {
+                             return _position >= _items.size();
+                           }),
+            this->mutablePositions.end());
+        this->hasMutablePositions.store(!this->mutablePositions.empty(),
+                                        std::memory_order_release);
+      }
+    }
+
+    /// \brief Map the stored names to their positions. The mutex must be
+    /// locked.
+    private: void IndexNamesUnlocked() const
+    {
+      this->positions.clear();
+      this->positions.reserve(this->names.size());
+      for (std::size_t i = 0; i < this->names.size(); ++i)
+      {
+        // Only the first item with each name is kept.
+        this->positions.emplace(this->names[i], i);
+      }
+      this->indexedSize.store(this->names.size(), std::memory_order_release);
+    }
+
+    /// \brief Forget the items marked as mutable. The mutex must be locked.
+    private: void ClearMutableUnlocked()
+    {
+      this->mutablePositions.clear();
+      this->marked.clear();
+      this->hasMutablePositions.store(false, std::memory_order_release);
+    }
+
+    /// \brief Names of the items when they were indexed, by position. A
+    /// deque is used, so that the keys of positions, which view these
+    /// names, stay valid when names are appended.
+    private: mutable std::deque<std::string> names;
+
+    /// \brief Position of the first item with each name.
+    private: mutable std::unordered_map<std::string_view, std::size_t>
+        positions;
+
+    /// \brief Number of items indexed, which lookups compare with the size
+    /// of the container without taking the mutex.
+    private: mutable std::atomic<std::size_t> indexedSize{0};
+
+    /// \brief Positions of the items handed out as mutable pointers.
+    private: mutable std::vector<std::size_t> mutablePositions;
+
+    /// \brief Whether each position is in mutablePositions.
+    private: mutable std::vector<bool> marked;
+
+    /// \brief True if mutablePositions is not empty, so that lookups can
+    /// skip the mutex otherwise.
+    private: mutable std::atomic<bool> hasMutablePositions{false};
+
+    /// \brief Mutex to look up the index from several threads, since
+    /// lookups can rebuild it.
+    private: mutable std::mutex mutex;
+  };
+  }
+}
+#endif
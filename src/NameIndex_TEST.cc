@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "NameIndex.hh"
+
+/// \brief Item with a name, like the children of a model.
+class Item
+{
+  public: explicit Item(const std::string &_name) : name(_name) {}
+  public: const std::string &Name() const { return this->name; }
+  public: void SetName(const std::string &_name) { this->name = _name; }
+  private: std::string name;
+};
+
+/////////////////////////////////////////////////
+TEST(NameIndex, Find)
+{
+  std::vector<Item> items;
+  sdf::NameIndex<Item> index;
+  EXPECT_EQ(nullptr, index.Find(items, "item0"));
+
+  for (int i = 0; i < 50; ++i)
+  {
+    items.emplace_back("item" + std::to_string(i));
+    index.Add(items);
+  }
+  for (int i = 0; i < 50; ++i)
+    EXPECT_EQ(&items[i], index.Find(items, "item" + std::to_string(i)));
+  EXPECT_EQ(nullptr, index.Find(items, "item50"));
+
+  // Names are looked up without a null terminator
+  const std::string scoped = "item12::item3";
+  EXPECT_EQ(&items[12],
+            index.Find(items, std::string_view(scoped).substr(0, 6)));
+
+  // The first of several items with the same name is found
+  items.emplace_back("item7");
+  index.Add(items);
+  EXPECT_EQ(&items[7], index.Find(items, "item7"));
+
+  // Renamed items are found once they were marked as mutable
+  items[3].SetName("renamed");
+  index.MarkMutable(3);
+  EXPECT_EQ(nullptr, index.Find(items, "item3"));
+  EXPECT_EQ(&items[3], index.Find(items, "renamed"));
+
+  // A renamed item comes first if it precedes the items with its new name
+  ASSERT_NE(nullptr, index.FindMutable(items, "item2"));
+  index.FindMutable(items, "item2")->SetName("item40");
+  EXPECT_EQ(&items[2], index.Find(items, "item40"));
+  EXPECT_EQ(nullptr, index.Find(items, "item2"));
+
+  // Items appended without the index are indexed by the next lookup
+  items.emplace_back("appended");
+  EXPECT_EQ(&items.back(), index.Find(items, "appended"));
+
+  index.Clear();
+  items.clear();
+  EXPECT_EQ(nullptr, index.Find(items, "item0"));
+}
+
+/////////////////////////////////////////////////
+TEST(NameIndex, KeptMutablePointers)
+{
+  std::vector<Item> items{Item("a"), Item("b"), Item("c")};
+  sdf::NameIndex<Item> index;
+  index.Rebuild(items);
+
+  // A pointer kept across other mutable lookups can rename its item later
+  Item *a = index.FindMutable(items, "a");
+  ASSERT_NE(nullptr, a);
+  ASSERT_NE(nullptr, index.FindMutable(items, "b"));
+  a->SetName("d");
+  EXPECT_EQ(&items[0], index.Find(items, "d"));
+  EXPECT_EQ(nullptr, index.Find(items, "a"));
+
+  // Also after the index was rebuilt for a rename
+  a->SetName("e");
+  EXPECT_EQ(&items[0], index.Find(items, "e"));
+  EXPECT_EQ(nullptr, index.Find(items, "d"));
+
+  // Copies check the same items
+  sdf::NameIndex<Item> copy(index);
+  a->SetName("f");
+  EXPECT_EQ(&items[0], copy.Find(items, "f"));
+
+  // Marked items that were removed from the container are forgotten
+  items.pop_back();
+  items.pop_back();
+  EXPECT_EQ(&items[0], index.Find(items, "f"));
+  EXPECT_EQ(nullptr, index.Find(items, "b"));
+  items.emplace_back("g");
+  index.Add(items);
+  EXPECT_EQ(&items[1], index.Find(items, "g"));
+}
+
+/////////////////////////////////////////////////
+TEST(NameIndex, ConcurrentFind)
+{
+  std::vector<Item> items;
+  for (int i = 0; i < 100; ++i)
+    items.emplace_back("item" + std::to_string(i));
+  sdf::NameIndex<Item> index;
+
+  // The first lookups index the container, and then take no lock
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t)
+  {
+    threads.emplace_back([&]()
+    {
+      for (int i = 0; i < 100; ++i)
+      {
+        if (index.Find(items, "item" + std::to_string(i)) != &items[i])
+          ++failures;
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  EXPECT_EQ(0, failures.load());
+}
@@ -17,27 +17,35 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstdint>
 #include <locale>
+#include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 #include <array>
 
-#include <locale.h>
 #include <math.h>
 
 #include "sdf/Assert.hh"
 #include "sdf/Param.hh"
 #include "sdf/Types.hh"
 #include "sdf/Element.hh"
+#include "ElementArena.hh"
+#include "FromChars.hh"
 
 using namespace sdf;
 
 // For some locale, the decimal separator is not a point, but a
-// comma. To avoid that the SDF parsing is influenced by the current
-// global C or C++ locale, we define a custom std::stringstream variant
-// that always uses the std::locale::classic() locale.
+// comma. To avoid that printing SDF values is influenced by the current
+// global C++ locale, we define a custom std::stringstream variant
+// that always uses the std::locale::classic() locale. Values are parsed
+// with std::from_chars, which never depends on the locale.
 // See issues https://github.com/osrf/sdformat/issues/60
 // and https://github.com/osrf/sdformat/issues/207 for more details.
 namespace sdf
@@ -353,6 +361,9 @@ void Param::Update(sdf::Errors &_errors)
 {
   if (this->dataPtr->updateFunc)
   {
+    // Parse a pending value first, so it does not replace the update later
+    this->ParsePendingValue(_errors);
+
     try
     {
       std::any newValue = this->dataPtr->updateFunc();
@@ -366,7 +377,7 @@ void Param::Update(sdf::Errors &_errors)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "Unable to set value using Update for key["
-          + this->dataPtr->key + "]"});
+          + this->dataPtr->descriptor->key.String() + "]"});
     }
   }
   else
@@ -390,10 +401,12 @@ std::string Param::GetAsString(const PrintConfig &_config) const
 std::string Param::GetAsString(sdf::Errors &_errors,
                                const PrintConfig &_config) const
 {
+  this->ParsePendingValue(_errors);
+
   std::string valueStr;
   if (this->GetSet() &&
       this->dataPtr->StringFromValueImpl(_config,
-                                         this->dataPtr->typeName,
+                                         this->dataPtr->descriptor->typeName,
                                          this->dataPtr->value,
                                          valueStr,
                                          _errors))
@@ -421,8 +434,8 @@ std::string Param::GetDefaultAsString(sdf::Errors &_errors,
   std::string defaultStr;
   if (this->dataPtr->StringFromValueImpl(
         _config,
-        this->dataPtr->typeName,
-        this->dataPtr->defaultValue,
+        this->dataPtr->descriptor->typeName,
+        this->dataPtr->descriptor->defaultValue,
         defaultStr,
         _errors))
   {
@@ -434,7 +447,8 @@ std::string Param::GetDefaultAsString(sdf::Errors &_errors,
       "using ParamStreamer instead."});
 
   StringStreamClassicLocale ss;
-  ss << ParamStreamer{ this->dataPtr->defaultValue, _config.OutPrecision() };
+  ss << ParamStreamer{ this->dataPtr->descriptor->defaultValue,
+                       _config.OutPrecision() };
   return ss.str();
 }
 
@@ -454,12 +468,13 @@ std::optional<std::string> Param::GetMinValueAsString(
     sdf::Errors &_errors,
     const PrintConfig &_config) const
 {
-  if (this->dataPtr->minValue.has_value())
+  const auto &descriptor = *this->dataPtr->descriptor;
+  if (descriptor.minValue.has_value())
   {
     std::string valueStr;
     if (!this->dataPtr->StringFromValueImpl(_config,
-                                            this->dataPtr->typeName,
-                                            this->dataPtr->minValue.value(),
+                                            descriptor.typeName,
+                                            descriptor.minValue.value(),
                                             valueStr,
                                             _errors))
     {
@@ -489,12 +504,13 @@ std::optional<std::string> Param::GetMaxValueAsString(
     sdf::Errors &_errors,
     const PrintConfig &_config) const
 {
-  if (this->dataPtr->maxValue.has_value())
+  const auto &descriptor = *this->dataPtr->descriptor;
+  if (descriptor.maxValue.has_value())
   {
     std::string valueStr;
     if (!this->dataPtr->StringFromValueImpl(_config,
-                                            this->dataPtr->typeName,
-                                            this->dataPtr->maxValue.value(),
+                                            descriptor.typeName,
+                                            descriptor.maxValue.value(),
                                             valueStr,
                                             _errors))
     {
@@ -509,29 +525,159 @@ std::optional<std::string> Param::GetMaxValueAsString(
 }
 
 //////////////////////////////////////////////////
-/// \brief Helper function for Param::ValueFromString
+/// \brief Whitespace that is ignored around values.
+static constexpr std::string_view kWhitespace = " \t\n";
+
+//////////////////////////////////////////////////
+/// \brief Whitespace that separates the numbers of a value, the same set
+/// that std::isspace matches in the "C" locale.
+static constexpr std::string_view kSeparators = " \t\n\v\f\r";
+
+//////////////////////////////////////////////////
+/// \brief Get a view of a string without its leading and trailing
+/// whitespace, like sdf::trim but without copying the string.
+/// \param[in] _in Input string.
+/// \return View of the trimmed string.
+static std::string_view trimView(std::string_view _in)
+{
+  const std::size_t strBegin = _in.find_first_not_of(kWhitespace);
+  if (strBegin == std::string_view::npos)
+    return {};
+
+  const std::size_t strEnd = _in.find_last_not_of(kWhitespace);
+  return _in.substr(strBegin, strEnd - strBegin + 1);
+}
+
+//////////////////////////////////////////////////
+/// \brief Compare two strings, ignoring the case of ASCII letters.
+/// \param[in] _a First string.
+/// \param[in] _b Second string, in lowercase.
+/// \return True if the strings are equal.
+static bool equalsLowercase(std::string_view _a, std::string_view _b)
+{
+  return _a.size() == _b.size() &&
+      std::equal(_a.begin(), _a.end(), _b.begin(),
+          [](char _x, char _y)
+          {
+            return std::tolower(static_cast<unsigned char>(_x)) == _y;
+          });
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the next whitespace separated token of a string.
+/// \param[in,out] _str String to read from. The token and the whitespace
+/// before it are removed.
+/// \param[out] _token The token.
+/// \return True if a token was found.
+static bool nextToken(std::string_view &_str, std::string_view &_token)
+{
+  const std::size_t tokenBegin = _str.find_first_not_of(kSeparators);
+  if (tokenBegin == std::string_view::npos)
+  {
+    _str = {};
+    return false;
+  }
+
+  _str.remove_prefix(tokenBegin);
+  const std::size_t tokenSize =
+      std::min(_str.find_first_of(kSeparators), _str.size());
+  _token = _str.substr(0, tokenSize);
+  _str.remove_prefix(tokenSize);
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Parse whitespace separated numbers, the way the stream input
+/// operators of the math types read them: each number must be finite, and
+/// anything after the last number is ignored.
+/// \param[in] _str String to parse.
+/// \param[out] _values The parsed numbers.
+/// \return True if all the numbers were parsed.
+template <typename T, std::size_t N>
+static bool parseNumbers(std::string_view _str, std::array<T, N> &_values)
+{
+  for (T &value : _values)
+  {
+    _str.remove_prefix(
+        std::min(_str.find_first_not_of(kSeparators), _str.size()));
+    if (fromChars(_str, value, false) != std::errc())
+      return false;
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+      if (!std::isfinite(value))
+        return false;
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Helper function for Param::ValueFromString for parsing the types
+/// that are made of a fixed number of numbers. The numbers are read the same
+/// way as the stream input operator of the type reads them.
 /// \param[in] _input Input string.
 /// \param[in] _key Key of the parameter, used for error message.
 /// \param[out] _value This will be set with the parsed value.
 /// \param[out] _errors Vector of errors.
 /// \return True if parsing succeeded.
 template <typename T>
-bool ParseUsingStringStream(const std::string &_input, const std::string &_key,
-                            ParamPrivate::ParamVariant &_value,
-                            sdf::Errors &_errors)
+bool ParseNumbers(std::string_view _input, const std::string &_key,
+                  ParamPrivate::ParamVariant &_value,
+                  sdf::Errors &_errors)
 {
-  StringStreamClassicLocale ss(_input);
-  T _val;
-  ss >> _val;
-  if (ss.fail())
+  bool parsed = false;
+  if constexpr (std::is_same_v<T, std::uint64_t>)
+  {
+    std::array<std::uint64_t, 1> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = values[0];
+  }
+  else if constexpr (std::is_same_v<T, sdf::Time>)
+  {
+    std::array<std::int32_t, 2> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = sdf::Time(values[0], values[1]);
+  }
+  else if constexpr (std::is_same_v<T, gz::math::Angle>)
+  {
+    std::array<double, 1> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = gz::math::Angle(values[0]);
+  }
+  else if constexpr (std::is_same_v<T, gz::math::Vector2i>)
+  {
+    std::array<int, 2> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = gz::math::Vector2i(values[0], values[1]);
+  }
+  else if constexpr (std::is_same_v<T, gz::math::Vector2d>)
+  {
+    std::array<double, 2> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = gz::math::Vector2d(values[0], values[1]);
+  }
+  else if constexpr (std::is_same_v<T, gz::math::Vector3d>)
+  {
+    std::array<double, 3> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = gz::math::Vector3d(values[0], values[1], values[2]);
+  }
+  else if constexpr (std::is_same_v<T, gz::math::Quaterniond>)
+  {
+    // Quaternions are written as roll, pitch and yaw angles
+    std::array<double, 3> values;
+    if ((parsed = parseNumbers(_input, values)))
+      _value = gz::math::Quaterniond(values[0], values[1], values[2]);
+  }
+
+  if (!parsed)
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
-        "Unknown error. Unable to set value [" + _input + " ] for key["
-           + _key + "]"});
-    return false;
+        "Unknown error. Unable to set value [" + std::string(_input)
+           + " ] for key[" + _key + "]"});
   }
-  _value = _val;
-  return true;
+  return parsed;
 }
 
 //////////////////////////////////////////////////
@@ -544,51 +690,52 @@ bool ParseUsingStringStream(const std::string &_input, const std::string &_key,
 /// \param[out] _value This will be set with the parsed value.
 /// \param[out] _errors Vector of errors.
 /// \return True if parsing colors succeeded.
-bool ParseColorUsingStringStream(const std::string &_input,
+bool ParseColor(std::string_view _input,
     const std::string &_key, ParamPrivate::ParamVariant &_value,
     sdf::Errors &_errors)
 {
-  StringStreamClassicLocale ss(_input);
-  std::string token;
-  std::vector<float> colors;
+  std::string_view remaining = _input;
+  std::string_view token;
+  std::array<float, 4> colors;
+  size_t colorSize = 0;
   float c;  // r,g,b,a values
   bool isValidColor = true;
-  while (ss >> token)
+  while (nextToken(remaining, token))
   {
     try
     {
-      c = std::stof(token);
-      colors.push_back(c);
+      c = stringToNumber<float>(token);
     }
-    // Catch invalid argument exception from std::stof
+    // Catch invalid argument exception from stringToNumber
     catch(std::invalid_argument &)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Invalid argument. Unable to set value [" + token
+          "Invalid argument. Unable to set value [" + std::string(token)
           + "] for key [" + _key + "]."});
       isValidColor = false;
       break;
     }
-    // Catch out of range exception from std::stof
+    // Catch out of range exception from stringToNumber
     catch(std::out_of_range &)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Out of range. Unable to set value [" + token
+          "Out of range. Unable to set value [" + std::string(token)
           + "] for key [" + _key + "]."});
       isValidColor = false;
       break;
     }
 
-    if (c < 0.0f || c > 1.0f)
+    // More than 4 values is invalid as well
+    if (c < 0.0f || c > 1.0f || colorSize == colors.size())
     {
       isValidColor = false;
       break;
     }
+    colors[colorSize++] = c;
   }
 
-  size_t colorSize = colors.size();
   if (isValidColor && colorSize == 3u)
-    colors.push_back(1.0f);
+    colors[colorSize++] = 1.0f;
   else if (colorSize != 4u)
     isValidColor = false;
 
@@ -599,7 +746,8 @@ bool ParseColorUsingStringStream(const std::string &_input,
   else
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
-        "The value <" + _key + ">" + _input + "</" + _key + "> is invalid."});
+        "The value <" + _key + ">" + std::string(_input) + "</" + _key +
+        "> is invalid."});
   }
 
   return isValidColor;
@@ -616,7 +764,7 @@ bool ParseColorUsingStringStream(const std::string &_input,
 /// \param[out] _value This will be set with the parsed value.
 /// \param[out] _errors Vector of errors.
 /// \return True if parsing pose succeeded.
-bool ParsePoseUsingStringStream(const std::string &_input,
+bool ParsePose(std::string_view _input,
     const std::string &_key, const Param_V &_attributes,
     ParamPrivate::ParamVariant &_value,
     sdf::Errors &_errors)
@@ -632,7 +780,7 @@ bool ParsePoseUsingStringStream(const std::string &_input,
 
   for (const auto &p : _attributes)
   {
-    const std::string key = p->GetKey();
+    const std::string &key = p->GetKey();
 
     if (key == "degrees")
     {
@@ -646,7 +794,8 @@ bool ParsePoseUsingStringStream(const std::string &_input,
     }
     else if (key == "rotation_format")
     {
-      rotationFormat = p->GetAsString(_errors);
+      if (!p->Get<std::string>(rotationFormat, _errors))
+        return false;
 
       if (rotationFormat == "euler_rpy")
       {
@@ -681,32 +830,32 @@ bool ParsePoseUsingStringStream(const std::string &_input,
     return true;
   }
 
-  StringStreamClassicLocale ss(_input);
-  std::string token;
+  std::string_view remaining = _input;
+  std::string_view token;
   std::array<double, 7> values;
   std::size_t valueIndex = 0;
   double v;
   bool isValidPose = true;
-  while (ss >> token)
+  while (nextToken(remaining, token))
   {
     try
     {
-      v = std::stod(token);
+      v = stringToNumber<double>(token);
     }
-    // Catch invalid argument exception from std::stod
+    // Catch invalid argument exception from stringToNumber
     catch(std::invalid_argument &)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Invalid argument. Unable to set value [" + _input
+          "Invalid argument. Unable to set value [" + std::string(_input)
           + "] for key [" + _key + "]."});
       isValidPose = false;
       break;
     }
-    // Catch out of range exception from std::stod
+    // Catch out of range exception from stringToNumber
     catch(std::out_of_range &)
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
-          "Out of range. Unable to set value [" + token
+          "Out of range. Unable to set value [" + std::string(token)
           + "] for key [" + _key + "]."});
       isValidPose = false;
       break;
@@ -725,7 +874,8 @@ bool ParsePoseUsingStringStream(const std::string &_input,
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
           "The value for //pose[@rotation_format='" + rotationFormat
           + "'] must have " + std::to_string(desiredSize)
-          + " values, but more than that were found in '" + _input + "'."});
+          + " values, but more than that were found in '"
+          + std::string(_input) + "'."});
       isValidPose = false;
       break;
     }
@@ -742,7 +892,7 @@ bool ParsePoseUsingStringStream(const std::string &_input,
         "The value for //pose[@rotation_format='" + rotationFormat
         + "'] must have " + std::to_string(desiredSize) + " values, but "
         + std::to_string(valueIndex) + " were found instead in '"
-        + _input + "'."});
+        + std::string(_input) + "'."});
     return false;
   }
 
@@ -768,32 +918,43 @@ bool ParsePoseUsingStringStream(const std::string &_input,
   return true;
 }
 
+//////////////////////////////////////////////////
+ParamPrivate::PendingValue::PendingValue(const PendingValue &_other)
+{
+  *this = _other;
+}
+
+//////////////////////////////////////////////////
+ParamPrivate::PendingValue &ParamPrivate::PendingValue::operator=(
+    const PendingValue &_other)
+{
+  if (this == &_other)
+    return *this;
+
+  std::lock_guard<std::mutex> lock(_other.mutex);
+  this->str = _other.str;
+  this->errors = _other.errors;
+  this->active.store(_other.active.load(std::memory_order_acquire),
+                     std::memory_order_release);
+  return *this;
+}
+
+//////////////////////////////////////////////////
+void ParamPrivate::PendingValue::Clear()
+{
+  this->str = std::nullopt;
+  this->errors = std::nullopt;
+  this->active.store(false, std::memory_order_release);
+}
+
 //////////////////////////////////////////////////
 void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
              const std::string &_default, bool _required,
              sdf::Errors &_errors,
              const std::string &_description)
 {
-  this->key = _key;
-  this->required = _required;
-  this->typeName = _typeName;
-  this->description = _description;
-  this->set = false;
-  this->ignoreParentAttributes = false;
-  this->defaultStrValue = _default;
-
-  if(!(this->ValueFromStringImpl(
-          this->typeName,
-          _default,
-          this->defaultValue,
-          _errors)))
-  {
-    _errors.push_back({ErrorCode::PARAMETER_ERROR,
-                     "Invalid parameter"});
-    return;
-  }
-  this->value = this->defaultValue;
-  this->strValue = std::nullopt;
+  this->Init(_key, _typeName, _default, _required, "", "", _errors,
+             _description);
 }
 
 //////////////////////////////////////////////////
@@ -803,13 +964,38 @@ void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
              sdf::Errors &_errors,
              const std::string &_description)
 {
-  this->Init(_key, _typeName, _default, _required, _errors, _description);
+  auto newDescriptor = std::make_shared<Descriptor>();
+  newDescriptor->key = _key;
+  newDescriptor->required = _required;
+  newDescriptor->typeName = _typeName;
+  newDescriptor->valueType = ValueTypeFromName(_typeName);
+  newDescriptor->description = _description;
+  newDescriptor->defaultStrValue = _default;
+  this->descriptor = newDescriptor;
+  this->set = false;
+  this->ignoreParentAttributes = false;
+  this->strValue = std::nullopt;
+
+  if (this->ValueFromStringImpl(
+          newDescriptor->valueType,
+          _default,
+          newDescriptor->defaultValue,
+          _errors))
+  {
+    this->value = newDescriptor->defaultValue;
+  }
+  else
+  {
+    _errors.push_back({ErrorCode::PARAMETER_ERROR,
+                     "Invalid parameter"});
+  }
+
   if (!_minValue.empty())
   {
     if (!(this->ValueFromStringImpl(
-            this->typeName,
+            newDescriptor->valueType,
             _minValue,
-            this->minValue.emplace(),
+            newDescriptor->minValue.emplace(),
             _errors)))
     {
       _errors.push_back({ErrorCode::PARAMETER_ERROR,
@@ -821,9 +1007,9 @@ void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
   if (!_maxValue.empty())
   {
     if(!(this->ValueFromStringImpl(
-            this->typeName,
+            newDescriptor->valueType,
             _maxValue,
-            this->maxValue.emplace(),
+            newDescriptor->maxValue.emplace(),
             _errors)))
 
     {
@@ -834,170 +1020,185 @@ void ParamPrivate::Init(const std::string &_key, const std::string &_typeName,
   }
 }
 
+//////////////////////////////////////////////////
+ParamPrivate::ValueType ParamPrivate::ValueTypeFromName(
+    const std::string &_typeName)
+{
+  static const std::unordered_map<std::string, ValueType> kValueTypes =
+  {
+    {"bool", ValueType::BOOL},
+    {"char", ValueType::CHAR},
+    {"std::string", ValueType::STRING},
+    {"string", ValueType::STRING},
+    {"int", ValueType::INT},
+    {"uint64_t", ValueType::UINT64},
+    {"unsigned int", ValueType::UNSIGNED_INT},
+    {"double", ValueType::DOUBLE},
+    {"float", ValueType::FLOAT},
+    {"sdf::Time", ValueType::TIME},
+    {"time", ValueType::TIME},
+    {"gz::math::Angle", ValueType::ANGLE},
+    {"angle", ValueType::ANGLE},
+    {"gz::math::Color", ValueType::COLOR},
+    {"color", ValueType::COLOR},
+    {"gz::math::Vector2i", ValueType::VECTOR2I},
+    {"vector2i", ValueType::VECTOR2I},
+    {"gz::math::Vector2d", ValueType::VECTOR2D},
+    {"vector2d", ValueType::VECTOR2D},
+    {"gz::math::Vector3d", ValueType::VECTOR3D},
+    {"vector3", ValueType::VECTOR3D},
+    {"gz::math::Pose3d", ValueType::POSE},
+    {"pose", ValueType::POSE},
+    {"Pose", ValueType::POSE},
+    {"gz::math::Quaterniond", ValueType::QUATERNION},
+    {"quaternion", ValueType::QUATERNION}
+  };
+
+  auto iter = kValueTypes.find(_typeName);
+  return iter != kValueTypes.end() ? iter->second : ValueType::UNKNOWN;
+}
+
 //////////////////////////////////////////////////
 bool ParamPrivate::ValueFromStringImpl(const std::string &_typeName,
                                        const std::string &_valueStr,
                                        ParamVariant &_valueToSet,
                                        sdf::Errors &_errors) const
 {
-  // Under some circumstances, latin locales (es_ES or pt_BR) will return a
-  // comma for decimal position instead of a dot, making the conversion
-  // to fail. See bug #60 for more information. Force to use always C
-  setlocale(LC_NUMERIC, "C");
-  std::string trimmed = sdf::trim(_valueStr);
-  std::string tmp(trimmed);
-  std::string lowerTmp = lowercase(trimmed);
+  const ValueType valueType = ValueTypeFromName(_typeName);
+  if (valueType == ValueType::UNKNOWN)
+  {
+    _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
+        "Unknown parameter type[" + _typeName + "]"});
+    return false;
+  }
+
+  return this->ValueFromStringImpl(valueType, _valueStr, _valueToSet,
+                                   _errors);
+}
+
+//////////////////////////////////////////////////
+bool ParamPrivate::ValueFromStringImpl(ValueType _valueType,
+                                       const std::string &_valueStr,
+                                       ParamVariant &_valueToSet,
+                                       sdf::Errors &_errors) const
+{
+  // Views of _valueStr are used below, so that parsing a value does not copy
+  // it. Numbers are parsed with std::from_chars, which does not depend on the
+  // global locale, see https://github.com/osrf/sdformat/issues/60.
+  const std::string_view trimmed = trimView(_valueStr);
+  std::string_view tmp = trimmed;
 
   // "true" and "false" doesn't work properly (except for string)
-  if (_typeName != "string" && _typeName != "std::string")
+  const bool isTrue = equalsLowercase(trimmed, "true");
+  const bool isFalse = equalsLowercase(trimmed, "false");
+  if (_valueType != ValueType::STRING)
   {
-    if (lowerTmp == "true")
+    if (isTrue)
     {
       tmp = "1";
     }
-    else if (lowerTmp == "false")
+    else if (isFalse)
     {
       tmp = "0";
     }
   }
 
-  bool isHex = lowerTmp.compare(0, 2, "0x") == 0;
-
   try
   {
-    // Try to use stoi and stoul for integers, and
-    // stof and stod for scalar floating point values.
-    int numericBase = 10;
-    if (isHex)
-    {
-      numericBase = 16;
-    }
-
-    if (_typeName == "bool")
+    switch (_valueType)
     {
-      if (lowerTmp == "true" || lowerTmp == "1")
-      {
-        _valueToSet = true;
-      }
-      else if (lowerTmp == "false" || lowerTmp == "0")
+      case ValueType::BOOL:
+        if (isTrue || trimmed == "1")
+        {
+          _valueToSet = true;
+        }
+        else if (isFalse || trimmed == "0")
+        {
+          _valueToSet = false;
+        }
+        else
+        {
+          _errors.push_back({ErrorCode::PARAMETER_ERROR,
+              "Invalid boolean value"});
+          return false;
+        }
+        break;
+      case ValueType::CHAR:
+        _valueToSet = tmp.empty() ? '\0' : tmp[0];
+        break;
+      case ValueType::STRING:
+        _valueToSet = std::string(tmp);
+        break;
+      case ValueType::INT:
+        _valueToSet = stringToNumber<int>(tmp);
+        break;
+      case ValueType::UINT64:
+        return ParseNumbers<std::uint64_t>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::UNSIGNED_INT:
+        _valueToSet = static_cast<unsigned int>(
+            stringToNumber<unsigned long>(tmp));
+        break;
+      case ValueType::DOUBLE:
+        _valueToSet = stringToNumber<double>(tmp);
+        break;
+      case ValueType::FLOAT:
+        _valueToSet = stringToNumber<float>(tmp);
+        break;
+      case ValueType::TIME:
+        return ParseNumbers<sdf::Time>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::ANGLE:
+        return ParseNumbers<gz::math::Angle>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::COLOR:
+        return ParseColor(tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::VECTOR2I:
+        return ParseNumbers<gz::math::Vector2i>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::VECTOR2D:
+        return ParseNumbers<gz::math::Vector2d>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::VECTOR3D:
+        return ParseNumbers<gz::math::Vector3d>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::POSE:
       {
-        _valueToSet = false;
+        const ElementPtr p = this->parentElement.lock();
+        if (!this->ignoreParentAttributes && p)
+        {
+          return ParsePose(tmp, this->descriptor->key, p->GetAttributes(),
+                           _valueToSet, _errors);
+        }
+        return ParsePose(tmp, this->descriptor->key, {}, _valueToSet, _errors);
       }
-      else
-      {
-        _errors.push_back({ErrorCode::PARAMETER_ERROR,
-            "Invalid boolean value"});
+      case ValueType::QUATERNION:
+        return ParseNumbers<gz::math::Quaterniond>(
+            tmp, this->descriptor->key, _valueToSet, _errors);
+      case ValueType::UNKNOWN:
+      default:
+        _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
+            "Unknown parameter type["
+            + this->descriptor->typeName.String() + "]"});
         return false;
-      }
-    }
-    else if (_typeName == "char")
-    {
-      _valueToSet = tmp[0];
-    }
-    else if (_typeName == "std::string" ||
-             _typeName == "string")
-    {
-      _valueToSet = tmp;
-    }
-    else if (_typeName == "int")
-    {
-      _valueToSet = std::stoi(tmp, nullptr, numericBase);
-    }
-    else if (_typeName == "uint64_t")
-    {
-      return ParseUsingStringStream<std::uint64_t>(tmp, this->key,
-                                                   _valueToSet, _errors);
-    }
-    else if (_typeName == "unsigned int")
-    {
-      _valueToSet = static_cast<unsigned int>(
-          std::stoul(tmp, nullptr, numericBase));
-    }
-    else if (_typeName == "double")
-    {
-      _valueToSet = std::stod(tmp);
-    }
-    else if (_typeName == "float")
-    {
-      _valueToSet = std::stof(tmp);
-    }
-    else if (_typeName == "sdf::Time" ||
-             _typeName == "time")
-    {
-      return ParseUsingStringStream<sdf::Time>(tmp, this->key,
-                                               _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Angle" ||
-             _typeName == "angle")
-    {
-      return ParseUsingStringStream<gz::math::Angle>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Color" ||
-             _typeName == "color")
-    {
-      return ParseColorUsingStringStream(tmp, this->key, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Vector2i" ||
-             _typeName == "vector2i")
-    {
-      return ParseUsingStringStream<gz::math::Vector2i>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Vector2d" ||
-             _typeName == "vector2d")
-    {
-      return ParseUsingStringStream<gz::math::Vector2d>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Vector3d" ||
-             _typeName == "vector3")
-    {
-      return ParseUsingStringStream<gz::math::Vector3d>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Pose3d" ||
-             _typeName == "pose" ||
-             _typeName == "Pose")
-    {
-      const ElementPtr p = this->parentElement.lock();
-      if (!this->ignoreParentAttributes && p)
-      {
-        return ParsePoseUsingStringStream(
-            tmp, this->key, p->GetAttributes(), _valueToSet, _errors);
-      }
-      return ParsePoseUsingStringStream(
-          tmp, this->key, {}, _valueToSet, _errors);
-    }
-    else if (_typeName == "gz::math::Quaterniond" ||
-             _typeName == "quaternion")
-    {
-      return ParseUsingStringStream<gz::math::Quaterniond>(
-          tmp, this->key, _valueToSet, _errors);
-    }
-    else
-    {
-      _errors.push_back({ErrorCode::UNKNOWN_PARAMETER_TYPE,
-          "Unknown parameter type[" + _typeName + "]"});
-      return false;
     }
   }
-  // Catch invalid argument exception from std::stoi/stoul/stod/stof
+  // Catch invalid argument exception from stringToNumber
   catch(std::invalid_argument &)
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
         "Invalid argument. Unable to set value ["
         + _valueStr + "] for key["
-        + this->key + "]."});
+        + this->descriptor->key.String() + "]."});
     return false;
   }
-  // Catch out of range exception from std::stoi/stoul/stod/stof
+  // Catch out of range exception from stringToNumber
   catch(std::out_of_range &)
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
         "Out of range. Unable to set value ["
         + _valueStr + " ] for key["
-        + this->key + "]."});
+        + this->descriptor->key.String() + "]."});
     return false;
   }
 
@@ -1242,9 +1443,10 @@ bool Param::SetFromString(const std::string &_value,
                           sdf::Errors &_errors)
 {
   this->dataPtr->ignoreParentAttributes = _ignoreParentAttributes;
+  this->dataPtr->pending.Clear();
   std::string str = sdf::trim(_value.c_str());
 
-  if (str.empty() && this->dataPtr->required)
+  if (str.empty() && this->dataPtr->descriptor->required)
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
         "Empty string used when setting a required parameter. Key["
@@ -1253,13 +1455,13 @@ bool Param::SetFromString(const std::string &_value,
   }
   else if (str.empty())
   {
-    this->dataPtr->value = this->dataPtr->defaultValue;
+    this->dataPtr->value = this->dataPtr->descriptor->defaultValue;
     this->dataPtr->strValue = str;
     return true;
   }
 
   auto oldValue = this->dataPtr->value;
-  if (!this->dataPtr->ValueFromStringImpl(this->dataPtr->typeName,
+  if (!this->dataPtr->ValueFromStringImpl(this->dataPtr->descriptor->valueType,
                                           str,
                                           this->dataPtr->value,
                                           _errors))
@@ -1279,6 +1481,81 @@ bool Param::SetFromString(const std::string &_value,
   return this->dataPtr->set;
 }
 
+//////////////////////////////////////////////////
+bool Param::SetFromStringDeferred(const std::string &_value)
+{
+  sdf::Errors errors;
+  bool result = this->SetFromStringDeferred(_value, errors);
+  if (!errors.empty())
+    sdferr << errors;
+  return result;
+}
+
+//////////////////////////////////////////////////
+bool Param::SetFromStringDeferred(const std::string &_value,
+                                  sdf::Errors &_errors)
+{
+  std::string str = sdf::trim(_value.c_str());
+
+  // Empty strings are cheap to handle, and must be rejected right away for
+  // required parameters.
+  if (str.empty())
+    return this->SetFromString(str, false, _errors);
+
+  this->dataPtr->ignoreParentAttributes = false;
+  this->dataPtr->pending.str = std::move(str);
+  this->dataPtr->pending.errors = std::nullopt;
+  this->dataPtr->pending.active.store(true, std::memory_order_release);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Param::ParsePendingValue(sdf::Errors &_errors) const
+{
+  auto &pending = this->dataPtr->pending;
+  if (!pending.active.load(std::memory_order_acquire))
+    return true;
+
+  std::lock_guard<std::mutex> lock(pending.mutex);
+
+  // Another read may have parsed the value while this one waited
+  if (!pending.str.has_value())
+    return true;
+
+  // This does the same as SetFromString, but only once the value is needed.
+  // A value that failed to parse is not parsed again, but its errors are
+  // reported by every read.
+  if (!pending.errors.has_value())
+  {
+    sdf::Errors errors;
+    auto oldValue = this->dataPtr->value;
+    auto oldStrValue = this->dataPtr->strValue;
+    if (this->dataPtr->ValueFromStringImpl(
+            this->dataPtr->descriptor->valueType, *pending.str,
+            this->dataPtr->value, errors))
+    {
+      this->dataPtr->strValue = *pending.str;
+
+      // Check if the value is permitted
+      if (this->ValidateParsedValue(errors))
+      {
+        this->dataPtr->set = true;
+        pending.str = std::nullopt;
+        pending.active.store(false, std::memory_order_release);
+        return true;
+      }
+    }
+
+    this->dataPtr->value = oldValue;
+    this->dataPtr->strValue = oldStrValue;
+    pending.errors = std::move(errors);
+  }
+
+  _errors.insert(_errors.end(), pending.errors->begin(),
+                 pending.errors->end());
+  return false;
+}
+
 //////////////////////////////////////////////////
 bool Param::SetFromString(const std::string &_value)
 {
@@ -1317,6 +1594,11 @@ bool Param::SetParentElement(ElementPtr _parentElement, sdf::Errors &_errors)
   auto prevParentElement = this->dataPtr->parentElement;
 
   this->dataPtr->parentElement = _parentElement;
+
+  // A pending value will be parsed with the new parent element when needed
+  if (this->dataPtr->pending.active.load(std::memory_order_acquire))
+    return true;
+
   if (!this->Reparse(_errors))
   {
     this->dataPtr->parentElement = prevParentElement;
@@ -1329,8 +1611,9 @@ bool Param::SetParentElement(ElementPtr _parentElement, sdf::Errors &_errors)
 //////////////////////////////////////////////////
 void Param::Reset()
 {
-  this->dataPtr->value = this->dataPtr->defaultValue;
+  this->dataPtr->value = this->dataPtr->descriptor->defaultValue;
   this->dataPtr->strValue = std::nullopt;
+  this->dataPtr->pending.Clear();
   this->dataPtr->set = false;
 }
 
@@ -1347,6 +1630,10 @@ bool Param::Reparse()
 //////////////////////////////////////////////////
 bool Param::Reparse(sdf::Errors &_errors)
 {
+  // A pending value is parsed with the current parent element anyway
+  if (this->dataPtr->pending.active.load(std::memory_order_acquire))
+    return this->ParsePendingValue(_errors);
+
   std::string strToReparse;
   if (this->dataPtr->strValue.has_value())
   {
@@ -1354,11 +1641,12 @@ bool Param::Reparse(sdf::Errors &_errors)
   }
   // A default PrintConfig can be used here, as Reparse() is not called in the
   // code path from the 'gz sdf -p' command.
-  else if (!this->dataPtr->StringFromValueImpl(PrintConfig(),
-                                               this->dataPtr->typeName,
-                                               this->dataPtr->defaultValue,
-                                               strToReparse,
-                                               _errors))
+  else if (!this->dataPtr->StringFromValueImpl(
+                PrintConfig(),
+                this->dataPtr->descriptor->typeName,
+                this->dataPtr->descriptor->defaultValue,
+                strToReparse,
+                _errors))
   {
     _errors.push_back({ErrorCode::PARAMETER_ERROR,
         "Failed to obtain string from default value during reparsing."});
@@ -1366,7 +1654,8 @@ bool Param::Reparse(sdf::Errors &_errors)
   }
 
   if (!this->dataPtr->ValueFromStringImpl(
-      this->dataPtr->typeName, strToReparse, this->dataPtr->value, _errors))
+      this->dataPtr->descriptor->valueType, strToReparse,
+      this->dataPtr->value, _errors))
   {
     if (const auto parentElement = this->dataPtr->parentElement.lock())
     {
@@ -1391,7 +1680,7 @@ bool Param::Reparse(sdf::Errors &_errors)
   // should be, so if strToReparse is empty, assign the correct default value.
   if (strToReparse.empty())
   {
-    this->dataPtr->value = this->dataPtr->defaultValue;
+    this->dataPtr->value = this->dataPtr->descriptor->defaultValue;
   }
   return true;
 }
@@ -1399,43 +1688,49 @@ bool Param::Reparse(sdf::Errors &_errors)
 //////////////////////////////////////////////////
 ParamPtr Param::Clone() const
 {
-  return std::make_shared<Param>(*this);
+  return makeArenaShared<Param>(*this);
 }
 
 //////////////////////////////////////////////////
 const std::string &Param::GetTypeName() const
 {
-  return this->dataPtr->typeName;
+  return this->dataPtr->descriptor->typeName;
 }
 
 /////////////////////////////////////////////////
 void Param::SetDescription(const std::string &_desc)
 {
-  this->dataPtr->description = _desc;
+  // The descriptor may be shared with copies of this param, which keep
+  // their description
+  auto newDescriptor =
+      std::make_shared<ParamPrivate::Descriptor>(*this->dataPtr->descriptor);
+  newDescriptor->description = _desc;
+  this->dataPtr->descriptor = std::move(newDescriptor);
 }
 
 /////////////////////////////////////////////////
 std::string Param::GetDescription() const
 {
-  return this->dataPtr->description;
+  return this->dataPtr->descriptor->description;
 }
 
 /////////////////////////////////////////////////
 const std::string &Param::GetKey() const
 {
-  return this->dataPtr->key;
+  return this->dataPtr->descriptor->key;
 }
 
 /////////////////////////////////////////////////
 bool Param::GetRequired() const
 {
-  return this->dataPtr->required;
+  return this->dataPtr->descriptor->required;
 }
 
 /////////////////////////////////////////////////
 bool Param::GetSet() const
 {
-  return this->dataPtr->set;
+  return this->dataPtr->set ||
+      this->dataPtr->pending.active.load(std::memory_order_acquire);
 }
 
 /////////////////////////////////////////////////
@@ -1457,6 +1752,15 @@ bool Param::ValidateValue() const
 
 /////////////////////////////////////////////////
 bool Param::ValidateValue(sdf::Errors &_errors) const
+{
+  if (!this->ParsePendingValue(_errors))
+    return false;
+
+  return this->ValidateParsedValue(_errors);
+}
+
+/////////////////////////////////////////////////
+bool Param::ValidateParsedValue(sdf::Errors &_errors) const
 {
   return std::visit(
       [this, &_errors](const auto &_val) -> bool
@@ -1466,9 +1770,9 @@ bool Param::ValidateValue(sdf::Errors &_errors) const
         // cppcheck-suppress unmatchedSuppression
         if constexpr (std::is_scalar_v<T>)
         {
-          if (this->dataPtr->minValue.has_value())
+          if (this->dataPtr->descriptor->minValue.has_value())
           {
-            if (_val < std::get<T>(*this->dataPtr->minValue))
+            if (_val < std::get<T>(*this->dataPtr->descriptor->minValue))
             {
               std::ostringstream oss;
               oss << "The value [" << _val
@@ -1479,9 +1783,9 @@ bool Param::ValidateValue(sdf::Errors &_errors) const
               return false;
             }
           }
-          if (this->dataPtr->maxValue.has_value())
+          if (this->dataPtr->descriptor->maxValue.has_value())
           {
-            if (_val > std::get<T>(*this->dataPtr->maxValue))
+            if (_val > std::get<T>(*this->dataPtr->descriptor->maxValue))
             {
               std::ostringstream oss;
               oss << "The value [" << _val
@@ -32,6 +32,25 @@ namespace sdf
 inline namespace SDF_VERSION_NAMESPACE {
 namespace ParamPassing {
 
+//////////////////////////////////////////////////
+/// \brief Check whether an element or any of its descendants has a name
+/// attribute, which a modification may use to rename an element.
+/// \param[in] _xml The xml element
+/// \return True if a name attribute was found
+static bool hasNameAttribute(const tinyxml2::XMLElement *_xml)
+{
+  if (_xml->Attribute("name"))
+    return true;
+
+  for (const tinyxml2::XMLElement *child = _xml->FirstChildElement(); child;
+       child = child->NextSiblingElement())
+  {
+    if (hasNameAttribute(child))
+      return true;
+  }
+  return false;
+}
+
 //////////////////////////////////////////////////
 void updateParams(const ParserConfig &_config,
                   const std::string &_source,
@@ -39,6 +58,10 @@ void updateParams(const ParserConfig &_config,
                   ElementPtr _includeSDF,
                   Errors &_errors)
 {
+  // elements of the included model by element identifier, shared by all
+  // the children, and built again once they have changed the model
+  ElementIdIndex index(_includeSDF);
+
   // loop through <experimental:params> children
   tinyxml2::XMLElement *childElemXml = nullptr;
   for (childElemXml = _childXmlParams->FirstChildElement();
@@ -120,8 +143,7 @@ void updateParams(const ParserConfig &_config,
       std::string attrName = attr;
 
       // check that elem doesn't already exist (except for //plugin)
-      elem  = getElementById(_includeSDF, childElemXml->Name(),
-                            elemIdAttr + "::" + attrName);
+      elem = index.Find(childElemXml->Name(), elemIdAttr + "::" + attrName);
       if (elem != nullptr && elem->GetName() != "plugin")
       {
         _errors.push_back({ErrorCode::DUPLICATE_NAME,
@@ -142,14 +164,12 @@ void updateParams(const ParserConfig &_config,
       else
       {
         // get parent element of new element
-        elem = getElementById(_includeSDF, "",
-                              elemIdAttr,
-                              true);
+        elem = index.Find("", elemIdAttr, true);
       }
     }
     else
     {
-      elem  = getElementById(_includeSDF, childElemXml->Name(), elemIdAttr);
+      elem = index.Find(childElemXml->Name(), elemIdAttr);
     }
 
     if (elem == nullptr)
@@ -164,6 +184,10 @@ void updateParams(const ParserConfig &_config,
 
     // *** Element modifications ***
 
+    // only modifications that keep the names of all elements keep the index
+    if (actionStr != "modify" || hasNameAttribute(childElemXml))
+      index.Invalidate();
+
     if (actionStr.empty())
     {
       // action attribute not in childElemXml so must be in all direct children
@@ -205,82 +229,70 @@ void updateParams(const ParserConfig &_config,
 }
 
 //////////////////////////////////////////////////
-ElementPtr getElementById(const ElementPtr _sdf,
-                          const std::string &_elemName,
-                          const std::string &_elemId,
-                          const bool _isParentElement)
+ElementIdIndex::ElementIdIndex(const ElementPtr _sdf)
+  : sdf(_sdf)
 {
-  // child element of includeSDF
-  ElementPtr childElem = _sdf->GetFirstElement()->GetFirstElement();
-
-  // start and stop idx of elemId for finding longest substring
-  int64_t startIdx = 0, stopIdx = 0, longestIdx = 0;
-  ElementPtr matchingChild = nullptr;
+}
 
-  // iterate through included model
-  while (childElem)
+//////////////////////////////////////////////////
+ElementPtr ElementIdIndex::Find(const std::string &_elemName,
+                                const std::string &_elemId,
+                                const bool _isParentElement)
+{
+  if (!this->valid)
   {
-    std::string childName;
-    if (childElem->HasAttribute("name"))
-    {
-      childName = childElem->GetAttribute("name")->GetAsString();
-
-      // for add action, found parent element
-      if (_isParentElement && _elemId == childName)
-        return childElem;
-
-      stopIdx = findPrefixLastIndex(_elemId, startIdx, childName);
-
-      if (stopIdx > longestIdx)
-      {
-        matchingChild = childElem;
+    this->elements.clear();
+    // children of the included model
+    ElementPtr model = this->sdf->GetFirstElement();
+    if (model)
+      this->AddChildren(model, "");
+    this->valid = true;
+  }
 
-        // found matching element break out of included model iteration
-        if (!_isParentElement && childElem->GetName() == _elemName
-              && _elemId.substr(startIdx) == childName)
-          break;
-        else if (_isParentElement && _elemId.substr(startIdx) == childName)
-          break;
+  auto it = this->elements.find(_elemId);
+  if (it == this->elements.end())
+    return nullptr;
 
-        longestIdx = stopIdx;
-      }
-    }
+  for (const ElementPtr &elem : it->second)
+  {
+    if (_isParentElement || elem->GetName() == _elemName)
+      return elem;
+  }
+  return nullptr;
+}
 
-    childElem = childElem->GetNextElement();
+//////////////////////////////////////////////////
+void ElementIdIndex::Invalidate()
+{
+  this->valid = false;
+}
 
-    // when no more children & found potential match,
-    // set next iteration to first element of match
-    if (!childElem && matchingChild)
-    {
-      childElem = matchingChild->GetFirstElement();
-      matchingChild = nullptr;
-      startIdx = longestIdx;
+//////////////////////////////////////////////////
+void ElementIdIndex::AddChildren(const ElementPtr &_elem,
+                                 const std::string &_prefix)
+{
+  for (ElementPtr child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    // only named elements can be identified, and contain identified elements
+    if (!child->HasAttribute("name"))
+      continue;
 
-      size_t found = _elemId.find("::", startIdx);
-      if (found != std::string::npos && (found - startIdx) == 1ul)
-      {
-        // past double colons
-        startIdx += 3;
-      }
-    }
+    const std::string elemId =
+        _prefix + child->GetAttribute("name")->GetAsString();
+    this->elements[elemId].push_back(child);
+    this->AddChildren(child, elemId + "::");
   }
-
-  // found no element match
-  if (!matchingChild)
-    childElem = nullptr;
-
-  return childElem;
 }
 
 //////////////////////////////////////////////////
-int64_t findPrefixLastIndex(const std::string &_elemId,
-                               const int64_t &_startIdx,
-                               const std::string &_ref)
+ElementPtr getElementById(const ElementPtr _sdf,
+                          const std::string &_elemName,
+                          const std::string &_elemId,
+                          const bool _isParentElement)
 {
-  if (_elemId.substr(_startIdx, _ref.size()) == _ref)
-    return _startIdx + (_ref.size()-1);
-
-  return -1;
+  ElementIdIndex index(_sdf);
+  return index.Find(_elemName, _elemId, _isParentElement);
 }
 
 //////////////////////////////////////////////////
@@ -460,7 +472,8 @@ void handleIndividualChildActions(const ParserConfig &_config,
       continue;
     }
 
-    ElementPtr elemChild = elemDesc->GetElementDescription(elemName);
+    // Element descriptions are shared, so modify a copy
+    ElementPtr elemChild = elemDesc->GetElementDescription(elemName)->Clone();
 
     if (!xmlToSdf(_config, _source, xmlChild, elemChild, _errors))
     {
@@ -475,7 +488,7 @@ void handleIndividualChildActions(const ParserConfig &_config,
 
     if (actionStr == "add")
     {
-      _elem->InsertElement(elemChild->Clone(), true);
+      _elem->InsertElement(elemChild, true);
     }
     else if (actionStr == "replace")
     {
@@ -19,6 +19,8 @@
 
 #include <tinyxml2.h>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "sdf/ParserConfig.hh"
 #include "sdf/SDFImpl.hh"
@@ -47,8 +49,55 @@ namespace sdf
                       ElementPtr _includeSDF,
                       Errors &_errors);
 
+    /// \brief Index of the named elements of an included model by their
+    /// element identifiers, e.g. "link::visual", so that the elements
+    /// identified by the children of //include/experimental:params are found
+    /// without searching the model for each of them. The index is built the
+    /// first time it is used, and again after it is invalidated.
+    class ElementIdIndex
+    {
+      /// \brief Constructor
+      /// \param[in] _sdf The loaded (from include) SDF pointer
+      public: explicit ElementIdIndex(const ElementPtr _sdf);
+
+      /// \brief Retrieves the specified element by the element identifier
+      /// and element name
+      /// \param[in] _elemName The element name, such as "model", "link",
+      /// "collision", "visual".
+      /// \param[in] _elemId The element identifier
+      /// \param[in] _isParentElement Is true if _elemId is the parent and does
+      /// not use _elemName to verify the correct element is found. Only used
+      /// for the add action
+      /// \return ElementPtr to the first specified element in document order,
+      /// nullptr if element could not found
+      public: ElementPtr Find(const std::string &_elemName,
+                              const std::string &_elemId,
+                              const bool _isParentElement = false);
+
+      /// \brief Mark the index as out of date, after elements of the
+      /// included model were added, removed or renamed.
+      public: void Invalidate();
+
+      /// \brief Index the named descendants of an element.
+      /// \param[in] _elem The element.
+      /// \param[in] _prefix Element identifier of the element followed by
+      /// "::", or empty for the included model.
+      private: void AddChildren(const ElementPtr &_elem,
+                                const std::string &_prefix);
+
+      /// \brief The loaded (from include) SDF pointer
+      private: ElementPtr sdf;
+
+      /// \brief Elements by element identifier, in document order.
+      private: std::unordered_map<std::string, std::vector<ElementPtr>>
+                   elements;
+
+      /// \brief True if the index matches the included model.
+      private: bool valid = false;
+    };
+
     /// \brief Retrieves the specified element by the element identifier
-    /// and element name
+    /// and element name. Use an ElementIdIndex to look up several elements.
     /// \param[in] _sdf The loaded (from include) SDF pointer
     /// \param[in] _elemName The element name, such as "model", "link",
     /// "collision", "visual".
@@ -63,15 +112,6 @@ namespace sdf
                               const std::string &_elemId,
                               const bool _isParentElement = false);
 
-    /// \brief Finds the last index of a matching substring in _elemId from _ref
-    /// \param[in] _elemId The element identifier
-    /// \param[in] _startIdx The starting index for the substring in _elemId
-    /// \param[in] _ref The reference to look for in _elemId
-    /// \return int64_t the last index of the matching prefix in _elemId
-    int64_t findPrefixLastIndex(const std::string &_elemId,
-                                const int64_t &_startIdx,
-                                const std::string &_ref);
-
     /// \brief Checks if the string is a valid action
     /// \param[in] _action The action
     /// \return True if the action is one of the following: add, modify, remove,
@@ -15,6 +15,7 @@
  *
  */
 #include <sstream>
+#include <string>
 #include <gtest/gtest.h>
 
 #include "ParamPassing.hh"
@@ -93,6 +94,50 @@ TEST(ParamPassing, GetElement)
   EXPECT_EQ(nullptr, paramPassElem);
 }
 
+/////////////////////////////////////////////////
+TEST(ParamPassing, ElementIdIndex)
+{
+  const std::string sdfString = R"(
+  <sdf version='1.11'>
+    <model name='test'>
+      <link name='link'>
+        <visual name='shape'>
+          <geometry><box><size>1 1 1</size></box></geometry>
+        </visual>
+        <collision name='shape'>
+          <geometry><box><size>1 1 1</size></box></geometry>
+        </collision>
+      </link>
+      <model name='nested'>
+        <link name='link'/>
+      </model>
+    </model>
+  </sdf>)";
+
+  sdf::SDFPtr sdf(new sdf::SDF());
+  sdf::init(sdf);
+  ASSERT_TRUE(sdf::readString(sdfString, sdf));
+
+  sdf::ElementPtr link = sdf->Root()->GetElement("model")->GetElement("link");
+  sdf::ParamPassing::ElementIdIndex index(sdf->Root());
+  EXPECT_EQ(link, index.Find("link", "link"));
+  EXPECT_EQ(link->GetElement("visual"), index.Find("visual", "link::shape"));
+  EXPECT_EQ(link->GetElement("collision"),
+            index.Find("collision", "link::shape"));
+  EXPECT_EQ(link->GetElement("visual"), index.Find("", "link::shape", true));
+  EXPECT_EQ(nullptr, index.Find("sensor", "link::shape"));
+  EXPECT_EQ(nullptr, index.Find("visual", "shape"));
+  EXPECT_NE(nullptr, index.Find("link", "nested::link"));
+  EXPECT_NE(link, index.Find("link", "nested::link"));
+
+  // Elements added to the model are found once the index is invalidated
+  sdf::ElementPtr sensor = link->AddElement("sensor");
+  sensor->GetAttribute("name")->Set<std::string>("sensor");
+  EXPECT_EQ(nullptr, index.Find("sensor", "link::sensor"));
+  index.Invalidate();
+  EXPECT_EQ(sensor, index.Find("sensor", "link::sensor"));
+}
+
 ////////////////////////////////////////
 // Test warnings outputs for GetElementByName
 TEST(ParamPassing, GetElementByNameWarningOutput)
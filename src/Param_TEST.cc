@@ -16,8 +16,12 @@
  */
 
 #include <any>
+#include <atomic>
 #include <cstdint>
 #include <limits>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -401,6 +405,71 @@ TEST(Param, Vector2i)
   EXPECT_EQ(value, gz::math::Vector2i(0, 0));
 }
 
+////////////////////////////////////////////////////
+TEST(Param, ValueType)
+{
+  using ValueType = sdf::ParamPrivate::ValueType;
+  EXPECT_EQ(ValueType::POSE, sdf::ParamPrivate::ValueTypeFromName("pose"));
+  EXPECT_EQ(ValueType::POSE, sdf::ParamPrivate::ValueTypeFromName("Pose"));
+  EXPECT_EQ(ValueType::POSE,
+            sdf::ParamPrivate::ValueTypeFromName("gz::math::Pose3d"));
+  EXPECT_EQ(ValueType::STRING,
+            sdf::ParamPrivate::ValueTypeFromName("std::string"));
+  EXPECT_EQ(ValueType::UNSIGNED_INT,
+            sdf::ParamPrivate::ValueTypeFromName("unsigned int"));
+  EXPECT_EQ(ValueType::UNKNOWN,
+            sdf::ParamPrivate::ValueTypeFromName("badtype"));
+
+  EXPECT_EQ(ValueType::VECTOR3D,
+            sdf::ParamPrivate::TypeToValueType<gz::math::Vector3d>());
+  EXPECT_EQ(ValueType::UINT64,
+            sdf::ParamPrivate::TypeToValueType<std::uint64_t>());
+  EXPECT_EQ(ValueType::UNKNOWN,
+            sdf::ParamPrivate::TypeToValueType<std::vector<int>>());
+
+  // Every type name produced by TypeToString resolves to the same kind
+  EXPECT_EQ(sdf::ParamPrivate::TypeToValueType<gz::math::Quaterniond>(),
+            sdf::ParamPrivate::ValueTypeFromName(
+                sdf::ParamPrivate::TypeToString<gz::math::Quaterniond>()));
+  EXPECT_EQ(sdf::ParamPrivate::TypeToValueType<sdf::Time>(),
+            sdf::ParamPrivate::ValueTypeFromName(
+                sdf::ParamPrivate::TypeToString<sdf::Time>()));
+}
+
+////////////////////////////////////////////////////
+TEST(Param, ValueFromStringWhitespaceAndCase)
+{
+  sdf::Param intParam("key", "int", "0", false, "description");
+  EXPECT_TRUE(intParam.SetFromString(" \t42\n"));
+  EXPECT_EQ(42, intParam.Get<int>());
+  EXPECT_TRUE(intParam.SetFromString("TRUE"));
+  EXPECT_EQ(1, intParam.Get<int>());
+  EXPECT_FALSE(intParam.SetFromString("99999999999"));
+
+  sdf::Param boolParam("key", "bool", "false", false, "description");
+  EXPECT_TRUE(boolParam.SetFromString(" True "));
+  EXPECT_TRUE(boolParam.Get<bool>());
+  EXPECT_TRUE(boolParam.SetFromString("0"));
+  EXPECT_FALSE(boolParam.Get<bool>());
+
+  sdf::Param stringParam("key", "string", "", false, "description");
+  EXPECT_TRUE(stringParam.SetFromString("  False "));
+  EXPECT_EQ("False", stringParam.Get<std::string>());
+
+  sdf::Param colorParam("key", "color", "0 0 0 1", false, "description");
+  EXPECT_TRUE(colorParam.SetFromString("0.5 0.25 1"));
+  EXPECT_EQ(gz::math::Color(0.5f, 0.25f, 1.0f, 1.0f),
+            colorParam.Get<gz::math::Color>());
+  EXPECT_FALSE(colorParam.SetFromString("0.5 0.25 1 1 1"));
+
+  sdf::Param poseParam("key", "pose", "0 0 0 0 0 0", false, "description");
+  EXPECT_TRUE(poseParam.SetFromString("\n 1 2\t3 0 0 0.5 \n"));
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0.5),
+            poseParam.Get<gz::math::Pose3d>());
+  EXPECT_FALSE(poseParam.SetFromString("1 2 3 0 0"));
+  EXPECT_FALSE(poseParam.SetFromString("1 2 3 a 0 0"));
+}
+
 ////////////////////////////////////////////////////
 TEST(Param, InvalidConstructor)
 {
@@ -575,6 +644,193 @@ TEST(Param, MinMaxViolation)
   }
 }
 
+//////////////////////////////////////////////////
+TEST(Param, SetFromStringDeferred)
+{
+  sdf::Param doubleParam("key", "double", "1.0", false, "0", "10.0",
+                         "description");
+  EXPECT_FALSE(doubleParam.GetSet());
+
+  // The value is parsed when it is first read
+  EXPECT_TRUE(doubleParam.SetFromStringDeferred(" 5.5 "));
+  EXPECT_TRUE(doubleParam.GetSet());
+  {
+    double value;
+    sdf::Errors errors;
+    EXPECT_TRUE(doubleParam.Get<double>(value, errors));
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_DOUBLE_EQ(value, 5.5);
+    EXPECT_EQ("5.5", doubleParam.GetAsString());
+  }
+
+  // An invalid value is reported by every read, which returns the previous
+  // value, and the parameter stays set
+  EXPECT_TRUE(doubleParam.SetFromStringDeferred("abc"));
+  for (int i = 0; i < 3; ++i)
+  {
+    double value;
+    sdf::Errors errors;
+    EXPECT_TRUE(doubleParam.Get<double>(value, errors));
+    ASSERT_FALSE(errors.empty()) << "read " << i;
+    EXPECT_EQ(sdf::ErrorCode::PARAMETER_ERROR, errors[0].Code());
+    EXPECT_DOUBLE_EQ(value, 5.5);
+    EXPECT_TRUE(doubleParam.GetSet());
+
+    errors.clear();
+    EXPECT_EQ("5.5", doubleParam.GetAsString(errors));
+    EXPECT_FALSE(errors.empty());
+  }
+
+  // So is a value out of range
+  EXPECT_TRUE(doubleParam.SetFromStringDeferred("11"));
+  {
+    sdf::Errors errors;
+    EXPECT_FALSE(doubleParam.ValidateValue(errors));
+    EXPECT_FALSE(errors.empty());
+
+    double value;
+    errors.clear();
+    EXPECT_TRUE(doubleParam.Get<double>(value, errors));
+    EXPECT_FALSE(errors.empty());
+    EXPECT_DOUBLE_EQ(value, 5.5);
+    EXPECT_TRUE(doubleParam.GetSet());
+
+    errors.clear();
+    EXPECT_FALSE(doubleParam.Reparse(errors));
+    EXPECT_FALSE(errors.empty());
+  }
+
+  // Copies keep the errors of an invalid value
+  {
+    sdf::Param invalidCopy(doubleParam);
+    sdf::Errors errors;
+    EXPECT_FALSE(invalidCopy.ValidateValue(errors));
+    EXPECT_FALSE(errors.empty());
+    EXPECT_TRUE(invalidCopy.GetSet());
+  }
+
+  // Copies parse the value independently
+  EXPECT_TRUE(doubleParam.SetFromStringDeferred("2"));
+  sdf::Param copy(doubleParam);
+  {
+    double value;
+    EXPECT_TRUE(copy.Get<double>(value));
+    EXPECT_DOUBLE_EQ(value, 2.0);
+    EXPECT_TRUE(doubleParam.Get<double>(value));
+    EXPECT_DOUBLE_EQ(value, 2.0);
+  }
+
+  // Reset discards a pending value
+  EXPECT_TRUE(doubleParam.SetFromStringDeferred("3"));
+  doubleParam.Reset();
+  EXPECT_FALSE(doubleParam.GetSet());
+  {
+    double value;
+    EXPECT_TRUE(doubleParam.Get<double>(value));
+    EXPECT_DOUBLE_EQ(value, 1.0);
+  }
+
+  // Empty values are checked right away
+  sdf::Param requiredParam("key", "double", "1.0", true, "description");
+  sdf::Errors errors;
+  EXPECT_FALSE(requiredParam.SetFromStringDeferred("", errors));
+  EXPECT_FALSE(errors.empty());
+}
+
+//////////////////////////////////////////////////
+TEST(Param, SetFromStringDeferredConcurrentReads)
+{
+  sdf::Param validParam("key", "double", "1.0", false, "description");
+  sdf::Param invalidParam("key", "double", "1.0", false, "description");
+  EXPECT_TRUE(validParam.SetFromStringDeferred("2.5"));
+  EXPECT_TRUE(invalidParam.SetFromStringDeferred("abc"));
+
+  // Every thread sees the parsed value, or the errors of the invalid one
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i)
+  {
+    threads.emplace_back([&]()
+    {
+      double value = 0;
+      sdf::Errors errors;
+      if (!validParam.Get<double>(value, errors) || !errors.empty() ||
+          value != 2.5)
+      {
+        ++failures;
+      }
+
+      errors.clear();
+      invalidParam.Get<double>(value, errors);
+      if (errors.empty() || value != 1.0 || !invalidParam.GetSet())
+        ++failures;
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  EXPECT_EQ(0, failures.load());
+}
+
+//////////////////////////////////////////////////
+TEST(Param, SetFromStringDeferredClone)
+{
+  auto poseElem = std::make_shared<sdf::Element>();
+  poseElem->SetName("pose");
+  poseElem->AddValue("pose", "0 0 0 0 0 0", false);
+  poseElem->AddAttribute("rotation_format", "string", "euler_rpy", false);
+
+  // A pending value, even an invalid one, does not prevent cloning
+  EXPECT_TRUE(poseElem->GetValue()->SetFromStringDeferred("1 2 3 0 0 0"));
+  sdf::ElementPtr clone;
+  ASSERT_NO_THROW(clone = poseElem->Clone());
+  EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+            clone->Get<gz::math::Pose3d>());
+
+  EXPECT_TRUE(poseElem->GetValue()->SetFromStringDeferred("1 2"));
+  ASSERT_NO_THROW(clone = poseElem->Clone());
+  sdf::Errors errors;
+  EXPECT_EQ(gz::math::Pose3d::Zero,
+            clone->Get<gz::math::Pose3d>(errors, ""));
+  EXPECT_FALSE(errors.empty());
+}
+
+//////////////////////////////////////////////////
+TEST(Param, GetIf)
+{
+  sdf::Param doubleParam("key", "double", "1.5", false, "description");
+
+  const double *value = doubleParam.GetIf<double>();
+  ASSERT_NE(nullptr, value);
+  EXPECT_DOUBLE_EQ(1.5, *value);
+  EXPECT_EQ(nullptr, doubleParam.GetIf<int>());
+
+  // The pointer refers to the value of the param, not to a copy
+  EXPECT_EQ(value, doubleParam.GetIf<double>());
+  EXPECT_TRUE(doubleParam.Set<double>(2.5));
+  EXPECT_DOUBLE_EQ(2.5, *value);
+
+  // A deferred value is parsed first
+  EXPECT_TRUE(doubleParam.SetFromStringDeferred("3.5"));
+  value = doubleParam.GetIf<double>();
+  ASSERT_NE(nullptr, value);
+  EXPECT_DOUBLE_EQ(3.5, *value);
+
+  // Other types have no pointer, and are read through Get
+  sdf::Errors errors;
+  EXPECT_EQ(nullptr, doubleParam.GetIf<float>(errors));
+  EXPECT_EQ(nullptr, doubleParam.GetIf<std::string>(errors));
+  EXPECT_TRUE(errors.empty()) << errors;
+  float floatValue = 0;
+  EXPECT_TRUE(doubleParam.Get<float>(floatValue));
+  EXPECT_FLOAT_EQ(3.5f, floatValue);
+
+  sdf::Param stringParam("key", "string", "text", false, "description");
+  const std::string *text = stringParam.GetIf<std::string>();
+  ASSERT_NE(nullptr, text);
+  EXPECT_EQ("text", *text);
+  EXPECT_EQ(nullptr, stringParam.GetIf<double>());
+}
+
 //////////////////////////////////////////////////
 TEST(Param, SettingParentElement)
 {
@@ -614,6 +870,27 @@ TEST(Param, CopyConstructor)
   EXPECT_EQ(parentElement, newParam.GetParentElement());
 }
 
+//////////////////////////////////////////////////
+TEST(Param, CopySetDescription)
+{
+  sdf::Param doubleParam("key", "double", "1.0", false, "0", "10.0",
+                         "description");
+  sdf::Param copy(doubleParam);
+  EXPECT_EQ("description", copy.GetDescription());
+
+  // Copies share their description data, but changing it on one of them
+  // does not affect the others
+  copy.SetDescription("new description");
+  EXPECT_EQ("new description", copy.GetDescription());
+  EXPECT_EQ("description", doubleParam.GetDescription());
+
+  EXPECT_EQ("key", copy.GetKey());
+  EXPECT_EQ("double", copy.GetTypeName());
+  EXPECT_EQ("1", copy.GetDefaultAsString());
+  EXPECT_EQ("10", copy.GetMaxValueAsString().value());
+  EXPECT_FALSE(copy.Set<double>(11.0));
+}
+
 //////////////////////////////////////////////////
 TEST(Param, EqualOperator)
 {
@@ -15,12 +15,17 @@
  *
  */
 
+#include <memory>
 #include <optional>
+#include <set>
+#include <string>
 
 #include "sdf/ParserConfig.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/Types.hh"
 #include "sdf/CustomInertiaCalcProperties.hh"
+#include "FindFileCache.hh"
+#include "IncludeCache.hh"
 
 using namespace sdf;
 
@@ -66,6 +71,49 @@ class sdf::ParserConfig::Implementation
 
   /// \brief Flag to expand URIs where possible store the resolved paths
   public: bool storeResolvedURIs = false;
+
+  /// \brief Flag to allocate the nodes of parsed documents from an arena.
+  public: bool arenaAllocation = false;
+
+  /// \brief Flag to record the line number and XML path of parsed elements.
+  public: bool sourceTracing = true;
+
+  /// \brief Flag to parse the values of parsed elements when first read.
+  public: bool lazyValueParsing = false;
+
+  /// \brief Flag to read documents without building a tinyxml2 document.
+  public: bool streamingParsing = false;
+
+  /// \brief Cache of included files, shared by copies of the config.
+  /// nullptr if included files are not cached.
+  public: std::shared_ptr<IncludeCache> includeCache;
+
+  /// \brief Number of threads used to read included files.
+  public: unsigned int includeThreadCount = 1;
+
+  /// \brief Cache of the paths found by sdf::findFile(), shared by copies
+  /// of the config. nullptr if the paths found are not cached.
+  public: std::shared_ptr<FindFileCache> findFileCache;
+
+  /// \brief Names of the elements skipped when documents are read.
+  public: std::set<std::string> skippedElements;
+
+  /// \brief Replace the find file cache by an empty one, if caching is
+  /// enabled. Copies of the config that share the old cache keep it.
+  public: void ResetFindFileCache()
+  {
+    if (this->findFileCache)
+      this->findFileCache = std::make_shared<FindFileCache>();
+  }
+
+  /// \brief Replace the include cache by an empty one, if caching is
+  /// enabled, because the cached documents were read with settings that
+  /// changed. Copies of the config that share the old cache keep it.
+  public: void ResetIncludeCache()
+  {
+    if (this->includeCache)
+      this->includeCache = std::make_shared<IncludeCache>();
+  }
 };
 
 
@@ -95,6 +143,8 @@ void ParserConfig::SetFindCallback(
     std::function<std::string(const std::string &)> _cb)
 {
   this->dataPtr->findFileCB = _cb;
+  this->dataPtr->ResetFindFileCache();
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -122,12 +172,15 @@ void ParserConfig::AddURIPath(const std::string &_uri, const std::string &_path)
       this->dataPtr->uriPathMap[_uri].push_back(part);
     }
   }
+  this->dataPtr->ResetFindFileCache();
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
 void ParserConfig::SetWarningsPolicy(EnforcementPolicy policy)
 {
   this->dataPtr->warningsPolicy = policy;
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -140,6 +193,7 @@ EnforcementPolicy ParserConfig::WarningsPolicy() const
 void ParserConfig::SetUnrecognizedElementsPolicy(EnforcementPolicy _policy)
 {
   this->dataPtr->unrecognizedElementsPolicy = _policy;
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -152,12 +206,14 @@ EnforcementPolicy ParserConfig::UnrecognizedElementsPolicy() const
 void ParserConfig::SetDeprecatedElementsPolicy(EnforcementPolicy _policy)
 {
   this->dataPtr->deprecatedElementsPolicy = _policy;
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
 void ParserConfig::ResetDeprecatedElementsPolicy()
 {
   this->dataPtr->deprecatedElementsPolicy.reset();
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -185,6 +241,7 @@ void ParserConfig::SetCalculateInertialConfiguration(
 void ParserConfig::RegisterCustomModelParser(CustomModelParser _modelParser)
 {
   this->dataPtr->customParsers.push_back(_modelParser);
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -210,6 +267,7 @@ const CustomInertiaCalculator &ParserConfig::CustomInertiaCalc() const
 void ParserConfig::URDFSetPreserveFixedJoint(bool _preserveFixedJoint)
 {
   this->dataPtr->preserveFixedJoint = _preserveFixedJoint;
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -228,6 +286,7 @@ void ParserConfig::SetStoreResovledURIs(bool _resolveURI)
 void ParserConfig::SetStoreResolvedURIs(bool _resolveURI)
 {
   this->dataPtr->storeResolvedURIs = _resolveURI;
+  this->dataPtr->ResetIncludeCache();
 }
 
 /////////////////////////////////////////////////
@@ -235,3 +294,143 @@ bool ParserConfig::StoreResolvedURIs() const
 {
   return this->dataPtr->storeResolvedURIs;
 }
+
+/////////////////////////////////////////////////
+void ParserConfig::SetArenaAllocation(bool _arenaAllocation)
+{
+  this->dataPtr->arenaAllocation = _arenaAllocation;
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::ArenaAllocation() const
+{
+  return this->dataPtr->arenaAllocation;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetSourceTracing(bool _sourceTracing)
+{
+  this->dataPtr->sourceTracing = _sourceTracing;
+  this->dataPtr->ResetIncludeCache();
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::SourceTracing() const
+{
+  return this->dataPtr->sourceTracing;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetLazyValueParsing(bool _lazyValueParsing)
+{
+  this->dataPtr->lazyValueParsing = _lazyValueParsing;
+  this->dataPtr->ResetIncludeCache();
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::LazyValueParsing() const
+{
+  return this->dataPtr->lazyValueParsing;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetStreamingParsing(bool _streamingParsing)
+{
+  this->dataPtr->streamingParsing = _streamingParsing;
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::StreamingParsing() const
+{
+  return this->dataPtr->streamingParsing;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetIncludeCaching(bool _includeCaching)
+{
+  if (!_includeCaching)
+    this->dataPtr->includeCache.reset();
+  else if (!this->dataPtr->includeCache)
+    this->dataPtr->includeCache = std::make_shared<IncludeCache>();
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::IncludeCaching() const
+{
+  return this->dataPtr->includeCache != nullptr;
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<IncludeCache> ParserConfig::IncludeFileCache() const
+{
+  return this->dataPtr->includeCache;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetIncludeThreadCount(unsigned int _threadCount)
+{
+  this->dataPtr->includeThreadCount = _threadCount;
+}
+
+/////////////////////////////////////////////////
+unsigned int ParserConfig::IncludeThreadCount() const
+{
+  return this->dataPtr->includeThreadCount;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetFindFileCaching(bool _findFileCaching)
+{
+  if (!_findFileCaching)
+    this->dataPtr->findFileCache.reset();
+  else if (!this->dataPtr->findFileCache)
+    this->dataPtr->findFileCache = std::make_shared<FindFileCache>();
+}
+
+/////////////////////////////////////////////////
+bool ParserConfig::FindFileCaching() const
+{
+  return this->dataPtr->findFileCache != nullptr;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::ClearFindFileCache()
+{
+  if (this->dataPtr->findFileCache)
+    this->dataPtr->findFileCache->Clear();
+}
+
+/////////////////////////////////////////////////
+std::size_t ParserConfig::FindFileCacheHitCount() const
+{
+  if (!this->dataPtr->findFileCache)
+    return 0;
+  return this->dataPtr->findFileCache->HitCount();
+}
+
+/////////////////////////////////////////////////
+std::size_t ParserConfig::FindFileCacheMissCount() const
+{
+  if (!this->dataPtr->findFileCache)
+    return 0;
+  return this->dataPtr->findFileCache->MissCount();
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<FindFileCache> ParserConfig::FindFileResults() const
+{
+  return this->dataPtr->findFileCache;
+}
+
+/////////////////////////////////////////////////
+void ParserConfig::SetSkippedElements(const std::set<std::string> &_names)
+{
+  this->dataPtr->skippedElements = _names;
+  this->dataPtr->ResetIncludeCache();
+}
+
+/////////////////////////////////////////////////
+const std::set<std::string> &ParserConfig::SkippedElements() const
+{
+  return this->dataPtr->skippedElements;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_PARSERCONFIGCACHES_HH_
+#define SDF_PARSERCONFIGCACHES_HH_
+
+#include <memory>
+
+#include "sdf/ParserConfig.hh"
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Gives the parser access to the caches held by a ParserConfig,
+  /// which are not part of its public API.
+  class ParserConfigCaches
+  {
+    /// \brief Get the cache of included files of a config.
+    /// \param[in] _config The config.
+    /// \return The cache, or nullptr if included files are not cached.
+    public: static std::shared_ptr<IncludeCache> IncludeFileCache(
+        const ParserConfig &_config)
+    {
+      return _config.IncludeFileCache();
+    }
+
+    /// \brief Get the cache of paths found by sdf::findFile() of a config.
+    /// \param[in] _config The config.
+    /// \return The cache, or nullptr if the paths found are not cached.
+    public: static std::shared_ptr<FindFileCache> FindFileResults(
+        const ParserConfig &_config)
+    {
+      return _config.FindFileResults();
+    }
+  };
+  }
+}
+#endif
@@ -15,11 +15,15 @@
  *
  */
 
+#include <set>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "sdf/Filesystem.hh"
 #include "sdf/ParserConfig.hh"
 #include "sdf/SDFImpl.hh"
+#include "ParserConfigCaches.hh"
 #include "test_config.hh"
 
 /////////////////////////////////////////////////
@@ -65,6 +69,118 @@ TEST(ParserConfig, Construction)
     config.CalculateInertialConfiguration());
   EXPECT_FALSE(config.URDFPreserveFixedJoint());
   EXPECT_FALSE(config.StoreResolvedURIs());
+  EXPECT_FALSE(config.ArenaAllocation());
+  config.SetArenaAllocation(true);
+  EXPECT_TRUE(config.ArenaAllocation());
+  EXPECT_TRUE(config.SourceTracing());
+  config.SetSourceTracing(false);
+  EXPECT_FALSE(config.SourceTracing());
+  EXPECT_FALSE(config.LazyValueParsing());
+  config.SetLazyValueParsing(true);
+  EXPECT_TRUE(config.LazyValueParsing());
+  EXPECT_FALSE(config.StreamingParsing());
+  config.SetStreamingParsing(true);
+  EXPECT_TRUE(config.StreamingParsing());
+  EXPECT_FALSE(config.IncludeCaching());
+  EXPECT_EQ(nullptr, sdf::ParserConfigCaches::IncludeFileCache(config));
+  config.SetIncludeCaching(true);
+  EXPECT_TRUE(config.IncludeCaching());
+  ASSERT_NE(nullptr, sdf::ParserConfigCaches::IncludeFileCache(config));
+  {
+    // Copies share the cache
+    sdf::ParserConfig copy = config;
+    EXPECT_EQ(sdf::ParserConfigCaches::IncludeFileCache(config),
+              sdf::ParserConfigCaches::IncludeFileCache(copy));
+  }
+  EXPECT_EQ(1u, config.IncludeThreadCount());
+  config.SetIncludeThreadCount(4);
+  EXPECT_EQ(4u, config.IncludeThreadCount());
+  EXPECT_FALSE(config.FindFileCaching());
+  EXPECT_EQ(nullptr, sdf::ParserConfigCaches::FindFileResults(config));
+  EXPECT_EQ(0u, config.FindFileCacheHitCount());
+  EXPECT_EQ(0u, config.FindFileCacheMissCount());
+  config.SetFindFileCaching(true);
+  EXPECT_TRUE(config.FindFileCaching());
+  ASSERT_NE(nullptr, sdf::ParserConfigCaches::FindFileResults(config));
+  {
+    // Copies share the cache until their search paths change
+    sdf::ParserConfig copy = config;
+    EXPECT_EQ(sdf::ParserConfigCaches::FindFileResults(config),
+              sdf::ParserConfigCaches::FindFileResults(copy));
+    copy.AddURIPath("test://", sdf::testing::TestFile("integration"));
+    EXPECT_NE(sdf::ParserConfigCaches::FindFileResults(config),
+              sdf::ParserConfigCaches::FindFileResults(copy));
+  }
+  EXPECT_TRUE(config.SkippedElements().empty());
+  config.SetSkippedElements({"visual", "gui"});
+  EXPECT_EQ(std::set<std::string>({"gui", "visual"}),
+            config.SkippedElements());
+}
+
+/////////////////////////////////////////////////
+/// Test that the include cache is replaced by the setters that change how
+/// included files are read.
+TEST(ParserConfig, IncludeCacheReset)
+{
+  sdf::ParserConfig config;
+  config.SetIncludeCaching(true);
+
+  // Check that the cache was replaced since the last check
+  auto includeCache = sdf::ParserConfigCaches::IncludeFileCache(config);
+  auto expectReset = [&config, &includeCache](const std::string &_setter)
+  {
+    const auto newCache = sdf::ParserConfigCaches::IncludeFileCache(config);
+    EXPECT_NE(nullptr, newCache) << _setter;
+    EXPECT_NE(includeCache, newCache) << _setter;
+    includeCache = newCache;
+  };
+
+  config.SetFindCallback([](const std::string &_uri) { return _uri; });
+  expectReset("SetFindCallback");
+
+  config.AddURIPath("test://", sdf::testing::TestFile("integration"));
+  expectReset("AddURIPath");
+
+  config.SetWarningsPolicy(sdf::EnforcementPolicy::ERR);
+  expectReset("SetWarningsPolicy");
+
+  config.SetUnrecognizedElementsPolicy(sdf::EnforcementPolicy::LOG);
+  expectReset("SetUnrecognizedElementsPolicy");
+
+  config.SetDeprecatedElementsPolicy(sdf::EnforcementPolicy::LOG);
+  expectReset("SetDeprecatedElementsPolicy");
+
+  config.ResetDeprecatedElementsPolicy();
+  expectReset("ResetDeprecatedElementsPolicy");
+
+  config.RegisterCustomModelParser(
+      [](const sdf::NestedInclude &, sdf::Errors &)
+          -> sdf::InterfaceModelPtr
+      {
+        return nullptr;
+      });
+  expectReset("RegisterCustomModelParser");
+
+  config.URDFSetPreserveFixedJoint(true);
+  expectReset("URDFSetPreserveFixedJoint");
+
+  config.SetStoreResolvedURIs(true);
+  expectReset("SetStoreResolvedURIs");
+
+  config.SetSourceTracing(false);
+  expectReset("SetSourceTracing");
+
+  config.SetLazyValueParsing(true);
+  expectReset("SetLazyValueParsing");
+
+  config.SetSkippedElements({"visual"});
+  expectReset("SetSkippedElements");
+
+  // Settings that do not change the documents read keep the cache
+  config.SetIncludeThreadCount(2);
+  config.SetArenaAllocation(true);
+  config.SetFindFileCaching(true);
+  EXPECT_EQ(includeCache, sdf::ParserConfigCaches::IncludeFileCache(config));
 }
 
 /////////////////////////////////////////////////
@@ -15,6 +15,7 @@
  *
 */
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -215,6 +216,18 @@ Errors Root::LoadSdfString(const std::string &_sdf)
 
 /////////////////////////////////////////////////
 Errors Root::LoadSdfString(const std::string &_sdf, const ParserConfig &_config)
+{
+  return this->LoadSdfString(std::string_view(_sdf), _config);
+}
+
+/////////////////////////////////////////////////
+Errors Root::LoadSdfString(const char *_sdf, const ParserConfig &_config)
+{
+  return this->LoadSdfString(std::string_view(_sdf), _config);
+}
+
+/////////////////////////////////////////////////
+Errors Root::LoadSdfString(std::string_view _sdf, const ParserConfig &_config)
 {
   Errors errors;
   SDFPtr sdfParsed(new SDF());
@@ -223,8 +236,8 @@ Errors Root::LoadSdfString(const std::string &_sdf, const ParserConfig &_config)
   // Read an SDF string, and store the result in sdfParsed.
   if (!readString(_sdf, _config, sdfParsed, errors))
   {
-    errors.push_back(
-        {ErrorCode::STRING_READ, "Unable to read SDF string: " + _sdf});
+    errors.push_back({ErrorCode::STRING_READ,
+        "Unable to read SDF string: " + std::string(_sdf)});
     return errors;
   }
 
@@ -15,6 +15,9 @@
  *
 */
 
+#include <string>
+#include <string_view>
+
 #include <gtest/gtest.h>
 #include "sdf/Actor.hh"
 #include "sdf/sdf_config.h"
@@ -164,6 +167,38 @@ TEST(DOMRoot, StringModelSdfParse)
   EXPECT_EQ(0u, root2.WorldCount());
 }
 
+/////////////////////////////////////////////////
+TEST(DOMRoot, StringViewSdfParse)
+{
+  // The view covers only the first document of the buffer, so it is not
+  // null terminated.
+  const std::string buffer =
+    "<sdf version='1.11'>"
+    "  <model name='shapes'><link name='link'/></model>"
+    "</sdf>"
+    "</world>";
+  const std::string_view sdf(buffer.data(), buffer.find("</sdf>") + 6);
+
+  for (bool streaming : {false, true})
+  {
+    sdf::ParserConfig config;
+    config.SetStreamingParsing(streaming);
+
+    sdf::Root root;
+    sdf::Errors errors = root.LoadSdfString(sdf, config);
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    const sdf::Model *model = root.Model();
+    ASSERT_NE(nullptr, model);
+    EXPECT_EQ("shapes", model->Name());
+    EXPECT_EQ(1u, model->LinkCount());
+  }
+
+  // The rest of the buffer is not valid XML.
+  sdf::Root root;
+  EXPECT_FALSE(root.LoadSdfString(buffer, sdf::ParserConfig()).empty());
+}
+
 /////////////////////////////////////////////////
 TEST(DOMRoot, StringLightSdfParse)
 {
@@ -21,6 +21,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,8 @@
 #include "SDFImplPrivate.hh"
 #include "sdf/sdf_config.h"
 #include "EmbeddedSdf.hh"
+#include "FindFileCache.hh"
+#include "ParserConfigCaches.hh"
 
 #include <gz/utils/Environment.hh>
 
@@ -67,8 +70,21 @@ std::string findFile(
 }
 
 /////////////////////////////////////////////////
-std::string findFile(const std::string &_filename, bool _searchLocalPath,
-                          bool _useCallback, const ParserConfig &_config)
+/// \brief Print the error of a file lookup that should have used the find
+/// file callback, but no callback is set.
+static void printEmptyCallbackError()
+{
+  sdferr << "Tried to use callback in sdf::findFile(), but the callback "
+    "is empty.  Did you call sdf::setFindCallback()?\n";
+}
+
+/////////////////////////////////////////////////
+/// \brief Find the absolute path of a file, without the cache of the
+/// parser configuration.
+/// \sa sdf::findFile() for the parameters and the order of search
+/// operations.
+static std::string findFileUncached(const std::string &_filename,
+    bool _searchLocalPath, bool _useCallback, const ParserConfig &_config)
 {
   // Check to see if _filename is URI. If so, resolve the URI path.
   for (const auto &[uriScheme, paths] : _config.URIPathMap())
@@ -162,8 +178,7 @@ std::string findFile(const std::string &_filename, bool _searchLocalPath,
   {
     if (!_config.FindFileCallback())
     {
-      sdferr << "Tried to use callback in sdf::findFile(), but the callback "
-        "is empty.  Did you call sdf::setFindCallback()?\n";
+      printEmptyCallbackError();
       return std::string();
     }
     else
@@ -175,6 +190,33 @@ std::string findFile(const std::string &_filename, bool _searchLocalPath,
   return std::string();
 }
 
+/////////////////////////////////////////////////
+std::string findFile(const std::string &_filename, bool _searchLocalPath,
+                          bool _useCallback, const ParserConfig &_config)
+{
+  const std::shared_ptr<FindFileCache> cache =
+      ParserConfigCaches::FindFileResults(_config);
+  if (!cache)
+  {
+    return findFileUncached(_filename, _searchLocalPath, _useCallback,
+                            _config);
+  }
+
+  std::string path;
+  if (cache->Get(_filename, _searchLocalPath, _useCallback, path))
+  {
+    // A file that was not found reached the callback, so the error of a
+    // missing callback is printed by every lookup, as without the cache.
+    if (path.empty() && _useCallback && !_config.FindFileCallback())
+      printEmptyCallbackError();
+    return path;
+  }
+
+  path = findFileUncached(_filename, _searchLocalPath, _useCallback, _config);
+  cache->Insert(_filename, _searchLocalPath, _useCallback, path);
+  return path;
+}
+
 /////////////////////////////////////////////////
 void addURIPath(const std::string &_uri, const std::string &_path)
 {
@@ -821,3 +821,96 @@ TEST(SDF, FindFileModelSDFCurrDir)
   std::filesystem::current_path(prevPath);
 }
 #endif  // _WIN32
+
+/////////////////////////////////////////////////
+TEST(SDF, FindFileCaching)
+{
+  std::string tmpDir;
+  ASSERT_TRUE(sdf::testing::TestTmpPath(tmpDir));
+  const std::string tempFile =
+      sdf::filesystem::append(tmpDir, "find_file_caching.sdf");
+  sdf::SDF tempSDF;
+  tempSDF.Write(tempFile);
+
+  int callbackCount = 0;
+  sdf::ParserConfig config;
+  config.AddURIPath("cache://", tmpDir);
+  config.SetFindCallback([&callbackCount](const std::string &)
+  {
+    ++callbackCount;
+    return std::string();
+  });
+  EXPECT_FALSE(config.FindFileCaching());
+  config.SetFindFileCaching(true);
+  EXPECT_TRUE(config.FindFileCaching());
+
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(tempFile,
+        sdf::findFile("cache://find_file_caching.sdf", false, true, config));
+    EXPECT_EQ("", sdf::findFile("cache://missing.sdf", false, true, config));
+  }
+  // Lookups that found no file are not searched again
+  EXPECT_EQ(1, callbackCount);
+  EXPECT_EQ(4u, config.FindFileCacheHitCount());
+  EXPECT_EQ(2u, config.FindFileCacheMissCount());
+
+  // The cache is not refreshed until it is cleared
+  ASSERT_EQ(std::remove(tempFile.c_str()), 0);
+  EXPECT_EQ(tempFile,
+      sdf::findFile("cache://find_file_caching.sdf", false, true, config));
+  config.ClearFindFileCache();
+  EXPECT_EQ("",
+      sdf::findFile("cache://find_file_caching.sdf", false, true, config));
+  EXPECT_EQ(2, callbackCount);
+
+  // Changing the callback starts a new cache
+  config.SetFindCallback([](const std::string &)
+  {
+    return std::string("coconut");
+  });
+  EXPECT_EQ(0u, config.FindFileCacheHitCount());
+  EXPECT_EQ(0u, config.FindFileCacheMissCount());
+  EXPECT_EQ("coconut",
+      sdf::findFile("cache://find_file_caching.sdf", false, true, config));
+
+  config.SetFindFileCaching(false);
+  EXPECT_EQ(0u, config.FindFileCacheMissCount());
+}
+
+/////////////////////////////////////////////////
+TEST(SDF, FindFileCachingEmptyCallback)
+{
+  std::stringstream buffer;
+  sdf::testing::RedirectConsoleStream redir(
+      sdf::Console::Instance()->GetMsgStream(), &buffer);
+
+  #ifdef _WIN32
+    sdf::Console::Instance()->SetQuiet(false);
+    sdf::testing::ScopeExit revertSetQuiet(
+      []
+      {
+        sdf::Console::Instance()->SetQuiet(true);
+      });
+  #endif
+
+  sdf::ParserConfig config;
+  config.SetFindFileCaching(true);
+
+  // The missing callback is reported by every lookup, even when the result
+  // comes from the cache
+  for (int i = 0; i < 2; ++i)
+  {
+    buffer.str("");
+    EXPECT_EQ("", sdf::findFile("missing.sdf", false, true, config));
+    EXPECT_NE(std::string::npos, buffer.str().find("callback is empty"))
+        << buffer.str();
+  }
+  EXPECT_EQ(1u, config.FindFileCacheHitCount());
+
+  // Lookups without the callback do not report it
+  buffer.str("");
+  EXPECT_EQ("", sdf::findFile("missing.sdf", false, false, config));
+  EXPECT_EQ(std::string::npos, buffer.str().find("callback is empty"))
+      << buffer.str();
+}
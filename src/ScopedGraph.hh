@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -48,9 +49,10 @@ struct ScopedGraphData
   std::string scopeContextName {};
 };
 
-// Forward declarations for static_assert
+// Forward declarations
 struct PoseRelativeToGraph;
 struct FrameAttachedToGraph;
+class PoseRelativeToCache;
 
 /// \brief The ScopedGraph allows manipulating FrameAttachedTo and
 /// PoseRelativeTo graphs within a smaller scope such as the scope of a model
@@ -226,6 +228,12 @@ class ScopedGraph
   /// \return  The ID of the scope vertex of this scope.
   public: VertexId ScopeVertexId() const;
 
+  /// \brief Get the cache of resolved poses of the graph. This is only
+  /// available for PoseRelativeToGraph.
+  /// \return The cache of resolved poses, which is shared by all the scopes
+  /// of the graph.
+  public: PoseRelativeToCache &PoseCache() const;
+
   /// \brief Check if the graph on which this scope is based is the same as the
   /// input graph.
   /// \param[in] _graph Graph object to check.
@@ -253,6 +261,9 @@ class ScopedGraph
   public: std::pair<std::string, bool> FindAndRemovePrefix(
               const std::string &_name) const;
 
+  /// \brief Clear the cache of resolved poses after the graph is changed.
+  private: void ClearPoseCache();
+
   /// \brief Shared pointer to either a FrameAttachedToGraph or
   /// PoseRelativeToGraph.
   private: std::shared_ptr<T> graphPtr;
@@ -340,6 +351,7 @@ auto ScopedGraph<T>::AddVertex(
   const std::string newName = this->AddPrefix(_name);
   Vertex &vert = this->graphPtr->graph.AddVertex(newName, _data);
   this->graphPtr->map[newName] = vert.Id();
+  this->ClearPoseCache();
   return vert;
 }
 
@@ -350,6 +362,7 @@ auto ScopedGraph<T>::AddEdge(
     -> Edge &
 {
   Edge &edge = this->graphPtr->graph.AddEdge(_vertexPair, _data);
+  this->ClearPoseCache();
   return edge;
 }
 
@@ -394,6 +407,7 @@ void ScopedGraph<T>::UpdateEdge(Edge &_edge, const EdgeType &_data)
   auto &graph = this->graphPtr->graph;
   graph.RemoveEdge(_edge.Id());
   _edge = graph.AddEdge({tailVertexId, headVertexId}, _data);
+  this->ClearPoseCache();
 }
 
 /////////////////////////////////////////////////
@@ -444,6 +458,21 @@ auto ScopedGraph<T>::ScopeVertexId() const -> VertexId
   return this->dataPtr->scopeVertexId;
 }
 
+/////////////////////////////////////////////////
+template <typename T>
+PoseRelativeToCache &ScopedGraph<T>::PoseCache() const
+{
+  return this->graphPtr->poseCache;
+}
+
+/////////////////////////////////////////////////
+template <typename T>
+void ScopedGraph<T>::ClearPoseCache()
+{
+  if constexpr (std::is_same_v<T, PoseRelativeToGraph>)
+    this->graphPtr->poseCache.Clear();
+}
+
 /////////////////////////////////////////////////
 template <typename T>
 bool ScopedGraph<T>::PointsTo(const std::shared_ptr<T> &_graph) const
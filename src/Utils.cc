@@ -16,11 +16,14 @@
 */
 #include <filesystem>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 #include "sdf/Assert.hh"
 #include "sdf/Filesystem.hh"
 #include "sdf/SDFImpl.hh"
+#include "ElementArena.hh"
 #include "Utils.hh"
 
 namespace sdf
@@ -104,6 +107,14 @@ void enforceConfigurablePolicyCondition(
   const sdf::Error &_error,
   sdf::Errors &_errors)
 {
+  // Printed conditions are recorded, so that they can be printed again.
+  PolicyConditionRecorder *recorder = PolicyConditionRecorder::Active();
+  if (recorder && (_policy == EnforcementPolicy::WARN ||
+                   _policy == EnforcementPolicy::LOG))
+  {
+    recorder->Record({_policy, _error});
+  }
+
   switch (_policy)
   {
     case EnforcementPolicy::ERR:
@@ -168,6 +179,49 @@ void enforceConfigurablePolicyCondition(
   }
 }
 
+/////////////////////////////////////////////////
+/// \brief Recorder of printed policy conditions active on each thread.
+static thread_local PolicyConditionRecorder *tlsPolicyConditionRecorder =
+    nullptr;
+
+/////////////////////////////////////////////////
+PolicyConditionRecorder::PolicyConditionRecorder(
+    PolicyConditionRecorder *_parent)
+  : parent(_parent), previous(tlsPolicyConditionRecorder)
+{
+  tlsPolicyConditionRecorder = this;
+}
+
+/////////////////////////////////////////////////
+PolicyConditionRecorder::~PolicyConditionRecorder()
+{
+  tlsPolicyConditionRecorder = this->previous;
+}
+
+/////////////////////////////////////////////////
+void PolicyConditionRecorder::Record(const PolicyCondition &_condition)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->conditions.push_back(_condition);
+  }
+  if (this->parent)
+    this->parent->Record(_condition);
+}
+
+/////////////////////////////////////////////////
+std::vector<PolicyCondition> PolicyConditionRecorder::Conditions() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->conditions;
+}
+
+/////////////////////////////////////////////////
+PolicyConditionRecorder *PolicyConditionRecorder::Active()
+{
+  return tlsPolicyConditionRecorder;
+}
+
 /////////////////////////////////////////////////
 void throwOrPrintErrors(const sdf::Errors& _errors)
 {
@@ -325,7 +379,7 @@ sdf::Errors loadIncludedInterfaceModels(sdf::ElementPtr _sdf,
 }
 
 /////////////////////////////////////////////////
-void copyChildren(ElementPtr _sdf, tinyxml2::XMLElement *_xml,
+void copyChildren(ElementPtr _sdf, tinyxml2::XMLNode *_xml,
     const bool _onlyUnknown)
 {
   // Iterate over all the child elements
@@ -360,7 +414,7 @@ void copyChildren(ElementPtr _sdf, tinyxml2::XMLElement *_xml,
     }
     else
     {
-      sdf::ElementPtr element(new sdf::Element);
+      sdf::ElementPtr element = makeArenaShared<sdf::Element>();
       element->SetParent(_sdf);
       element->SetName(elemName);
       for (const tinyxml2::XMLAttribute *attribute = elemXml->FirstAttribute();
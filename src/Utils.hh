@@ -18,6 +18,7 @@
 #define SDFORMAT_UTILS_HH
 
 #include <algorithm>
+#include <mutex>
 #include <string>
 #include <optional>
 #include <utility>
@@ -86,6 +87,66 @@ namespace sdf
     const sdf::Error &_error,
     sdf::Errors &_errors);
 
+  /// \brief A condition that enforceConfigurablePolicyCondition printed,
+  /// rather than appended to an errors vector.
+  struct PolicyCondition
+  {
+    /// \brief The policy the condition was printed with, WARN or LOG.
+    sdf::EnforcementPolicy policy;
+
+    /// \brief The condition.
+    sdf::Error error;
+  };
+
+  /// \brief Records the conditions printed by
+  /// enforceConfigurablePolicyCondition on the calling thread while it
+  /// exists, so that they can be printed again, e.g. when a cached include
+  /// is used. Each condition is also forwarded to the parent recorder, so
+  /// recorders can be nested and shared with worker threads.
+  class PolicyConditionRecorder
+  {
+    /// \brief Constructor. Makes this recorder the active one on the
+    /// calling thread.
+    /// \param[in] _parent Recorder to forward the conditions to. By default
+    /// the recorder that was active on the calling thread.
+    public: explicit PolicyConditionRecorder(
+        PolicyConditionRecorder *_parent = Active());
+
+    /// \brief Destructor. Restores the previously active recorder.
+    public: ~PolicyConditionRecorder();
+
+    /// \brief Recorders can not be copied.
+    public: PolicyConditionRecorder(const PolicyConditionRecorder &) = delete;
+
+    /// \brief Recorders can not be copied.
+    public: PolicyConditionRecorder &operator=(
+        const PolicyConditionRecorder &) = delete;
+
+    /// \brief Record a condition, and forward it to the parent recorder.
+    /// \param[in] _condition The condition.
+    public: void Record(const PolicyCondition &_condition);
+
+    /// \brief Get the conditions recorded so far.
+    /// \return The conditions, in the order they were recorded.
+    public: std::vector<PolicyCondition> Conditions() const;
+
+    /// \brief Get the recorder active on the calling thread.
+    /// \return The active recorder, or nullptr if there is none.
+    public: static PolicyConditionRecorder *Active();
+
+    /// \brief Recorder to forward the conditions to.
+    private: PolicyConditionRecorder *parent;
+
+    /// \brief Recorder that was active on this thread before this one.
+    private: PolicyConditionRecorder *previous;
+
+    /// \brief The recorded conditions.
+    private: std::vector<PolicyCondition> conditions;
+
+    /// \brief Mutex to record from several threads.
+    private: mutable std::mutex mutex;
+  };
+
   /// \brief It will print the errors to sdferr or throw them using
   /// SDF_ASSERT depending on their ErrorCode.
   /// \param[in] _errors  The vector of errors.
@@ -107,11 +168,14 @@ namespace sdf
   {
     Errors errors;
 
-    std::vector<std::string> names;
-
     // Check that an element exists.
     if (_sdf->HasElement(_sdfName))
     {
+      const std::size_t count = _sdf->GetElementCount(_sdfName);
+      _objs.reserve(_objs.size() + count);
+      std::unordered_set<std::string> names;
+      names.reserve(count);
+
       // Read all the elements.
       sdf::ElementPtr elem = _sdf->GetElement(_sdfName);
       while (elem)
@@ -130,7 +194,7 @@ namespace sdf
           sdf::loadName(elem, name);
 
           // Check that the name does not exist.
-          if (std::find(names.begin(), names.end(), name) != names.end())
+          if (!names.insert(name).second)
           {
             errors.push_back({ErrorCode::DUPLICATE_NAME,
                 _sdfName + " with name[" + name + "] already exists."});
@@ -139,7 +203,6 @@ namespace sdf
           {
             // Add the object to the result if no errors have been encountered.
             _objs.push_back(std::move(obj));
-            names.push_back(name);
           }
 
           // Add the load errors to the master error list.
@@ -174,6 +237,8 @@ namespace sdf
     // Check that an element exists.
     if (_sdf->HasElement(_sdfName))
     {
+      _objs.reserve(_objs.size() + _sdf->GetElementCount(_sdfName));
+
       // Read all the elements.
       sdf::ElementPtr elem = _sdf->GetElement(_sdfName);
       while (elem)
@@ -253,10 +318,10 @@ namespace sdf
   /// \brief Copy all children from the provided tinyxml2 object into the
   /// provided sdf element pointer.
   /// \param[in, out] _sdf A valid sdf element pointer.
-  /// \param[in] _xml XML to copy.
+  /// \param[in] _xml XML to copy, an element or a document.
   /// \param[in] _onlyUnknown Set this to true to only copy XML elements that
   /// do not have a matching description in the provided sdf element pointer.
-  void copyChildren(ElementPtr _sdf, tinyxml2::XMLElement *_xml,
+  void copyChildren(ElementPtr _sdf, tinyxml2::XMLNode *_xml,
       const bool _onlyUnknown);
 
   /// \brief Attempt to resolve a URI based on the current parser configuration
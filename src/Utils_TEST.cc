@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <string>
+#include <thread>
 #include <gz/math/Pose3.hh>
 #include "sdf/Element.hh"
 #include "Utils.hh"
@@ -153,3 +154,43 @@ TEST(PolicyUtils, EnforcementPolicyErrors)
   ASSERT_TRUE(errors[0].LineNumber().has_value());
   EXPECT_EQ(errors[0].LineNumber().value(), 10);
 }
+
+/////////////////////////////////////////////////
+TEST(PolicyUtils, PolicyConditionRecorder)
+{
+  EXPECT_EQ(nullptr, sdf::PolicyConditionRecorder::Active());
+
+  sdf::Errors errors;
+  const sdf::Error error(sdf::ErrorCode::ELEMENT_INCORRECT_TYPE, "condition");
+  sdf::PolicyConditionRecorder outer;
+  EXPECT_EQ(&outer, sdf::PolicyConditionRecorder::Active());
+  {
+    // Nested recorders forward the conditions to their parent
+    sdf::PolicyConditionRecorder inner;
+    EXPECT_EQ(&inner, sdf::PolicyConditionRecorder::Active());
+    sdf::enforceConfigurablePolicyCondition(
+        sdf::EnforcementPolicy::LOG, error, errors);
+    ASSERT_EQ(1u, inner.Conditions().size());
+    EXPECT_EQ(sdf::EnforcementPolicy::LOG, inner.Conditions()[0].policy);
+    EXPECT_EQ("condition", inner.Conditions()[0].error.Message());
+  }
+  EXPECT_EQ(&outer, sdf::PolicyConditionRecorder::Active());
+
+  // Errors are not printed, and so not recorded
+  sdf::enforceConfigurablePolicyCondition(
+      sdf::EnforcementPolicy::ERR, error, errors);
+  EXPECT_EQ(1u, errors.size());
+  EXPECT_EQ(1u, outer.Conditions().size());
+
+  // A recorder created on another thread forwards to the given parent
+  std::thread thread([&outer, &error]()
+  {
+    EXPECT_EQ(nullptr, sdf::PolicyConditionRecorder::Active());
+    sdf::PolicyConditionRecorder recorder(&outer);
+    sdf::Errors threadErrors;
+    sdf::enforceConfigurablePolicyCondition(
+        sdf::EnforcementPolicy::LOG, error, threadErrors);
+  });
+  thread.join();
+  EXPECT_EQ(2u, outer.Conditions().size());
+}
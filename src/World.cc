@@ -15,6 +15,7 @@
  *
 */
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 #include <optional>
@@ -36,6 +37,7 @@
 #include "sdf/Types.hh"
 #include "sdf/World.hh"
 #include "FrameSemantics.hh"
+#include "NameIndex.hh"
 #include "ScopedGraph.hh"
 #include "Utils.hh"
 #include "sdf/parser.hh"
@@ -71,6 +73,12 @@ class sdf::World::Implementation
   /// \brief The joints specified in this world.
   public: std::vector<Joint> joints;
 
+  /// \brief Index of the explicit frames by name.
+  public: NameIndex<Frame> frameIndex;
+
+  /// \brief Index of the joints by name.
+  public: NameIndex<Joint> jointIndex;
+
   /// \brief The lights specified in this world.
   public: std::vector<Light> lights;
 
@@ -88,6 +96,9 @@ class sdf::World::Implementation
   /// \brief The models specified in this world.
   public: std::vector<Model> models;
 
+  /// \brief Index of the models by name.
+  public: NameIndex<Model> modelIndex;
+
   /// \brief The interface models specified in this world.
   public: std::vector<std::pair<sdf::NestedInclude,
           sdf::InterfaceModelConstPtr>> interfaceModels;
@@ -362,6 +373,11 @@ Errors World::Load(sdf::ElementPtr _sdf, const ParserConfig &_config)
     implicitFrameNames.insert(frameName);
   }
 
+  // Index the children by name, now that the frames have their final names.
+  this->dataPtr->frameIndex.Rebuild(this->dataPtr->frames);
+  this->dataPtr->jointIndex.Rebuild(this->dataPtr->joints);
+  this->dataPtr->modelIndex.Rebuild(this->dataPtr->models);
+
   // Load all the physics.
   if (_sdf->HasElement("physics"))
   {
@@ -495,8 +511,10 @@ const Model *World::ModelByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Model *World::ModelByIndex(uint64_t _index)
 {
-  return const_cast<Model*>(
-      static_cast<const World*>(this)->ModelByIndex(_index));
+  if (_index >= this->dataPtr->models.size())
+    return nullptr;
+  this->dataPtr->modelIndex.MarkMutable(_index);
+  return &this->dataPtr->models[_index];
 }
 
 /////////////////////////////////////////////////
@@ -508,22 +526,19 @@ bool World::ModelNameExists(const std::string &_name) const
 /////////////////////////////////////////////////
 const Model *World::ModelByName(const std::string &_name) const
 {
-  auto index = _name.find("::");
-  const std::string nextModelName = _name.substr(0, index);
-  const Model *nextModel = nullptr;
+  return this->ModelByNameView(_name);
+}
 
-  for (auto const &m : this->dataPtr->models)
-  {
-    if (m.Name() == nextModelName)
-    {
-      nextModel = &m;
-      break;
-    }
-  }
+/////////////////////////////////////////////////
+const Model *World::ModelByNameView(std::string_view _name) const
+{
+  auto index = _name.find("::");
+  const Model *nextModel = this->dataPtr->modelIndex.Find(
+      this->dataPtr->models, _name.substr(0, index));
 
-  if (nullptr != nextModel && index != std::string::npos)
+  if (nullptr != nextModel && index != std::string_view::npos)
   {
-    return nextModel->ModelByName(_name.substr(index + 2));
+    return nextModel->ModelByNameView(_name.substr(index + 2));
   }
   return nextModel;
 }
@@ -531,8 +546,17 @@ const Model *World::ModelByName(const std::string &_name) const
 /////////////////////////////////////////////////
 Model *World::ModelByName(const std::string &_name)
 {
-  return const_cast<Model*>(
-      static_cast<const World*>(this)->ModelByName(_name));
+  // The model is marked as mutable in the index of the model or world that
+  // holds it, so the models are followed through mutable pointers.
+  auto index = _name.find("::");
+  Model *nextModel = this->dataPtr->modelIndex.FindMutable(
+      this->dataPtr->models, _name.substr(0, index));
+
+  if (nullptr != nextModel && index != std::string::npos)
+  {
+    return nextModel->ModelByName(_name.substr(index + 2));
+  }
+  return nextModel;
 }
 
 /////////////////////////////////////////////////
@@ -608,8 +632,10 @@ const Frame *World::FrameByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Frame *World::FrameByIndex(uint64_t _index)
 {
-  return const_cast<Frame*>(
-      static_cast<const World*>(this)->FrameByIndex(_index));
+  if (_index >= this->dataPtr->frames.size())
+    return nullptr;
+  this->dataPtr->frameIndex.MarkMutable(_index);
+  return &this->dataPtr->frames[_index];
 }
 
 /////////////////////////////////////////////////
@@ -621,13 +647,14 @@ bool World::FrameNameExists(const std::string &_name) const
 /////////////////////////////////////////////////
 const Frame *World::FrameByName(const std::string &_name) const
 {
-  auto index = _name.rfind("::");
-  if (index != std::string::npos)
+  const std::string_view name = _name;
+  auto index = name.rfind("::");
+  if (index != std::string_view::npos)
   {
-    const Model *model = this->ModelByName(_name.substr(0, index));
+    const Model *model = this->ModelByNameView(name.substr(0, index));
     if (nullptr != model)
     {
-      return model->FrameByName(_name.substr(index + 2));
+      return model->FrameByNameView(name.substr(index + 2));
     }
 
     // The nested model name preceding the last "::" could not be found.
@@ -637,21 +664,24 @@ const Frame *World::FrameByName(const std::string &_name) const
     // return nullptr;
   }
 
-  for (auto const &f : this->dataPtr->frames)
-  {
-    if (f.Name() == _name)
-    {
-      return &f;
-    }
-  }
-  return nullptr;
+  return this->dataPtr->frameIndex.Find(this->dataPtr->frames, name);
 }
 
 /////////////////////////////////////////////////
 Frame *World::FrameByName(const std::string &_name)
 {
-  return const_cast<Frame*>(
-      static_cast<const World*>(this)->FrameByName(_name));
+  // The frame is marked as mutable in the index of the model or world
+  // that holds it, so the models are followed through mutable pointers.
+  auto index = _name.rfind("::");
+  if (index != std::string::npos)
+  {
+    Model *model = this->ModelByName(_name.substr(0, index));
+    if (nullptr != model)
+    {
+      return model->FrameByName(_name.substr(index + 2));
+    }
+  }
+  return this->dataPtr->frameIndex.FindMutable(this->dataPtr->frames, _name);
 }
 
 /////////////////////////////////////////////////
@@ -671,20 +701,23 @@ const Joint *World::JointByIndex(const uint64_t _index) const
 /////////////////////////////////////////////////
 Joint *World::JointByIndex(uint64_t _index)
 {
-  return const_cast<Joint*>(
-      static_cast<const World*>(this)->JointByIndex(_index));
+  if (_index >= this->dataPtr->joints.size())
+    return nullptr;
+  this->dataPtr->jointIndex.MarkMutable(_index);
+  return &this->dataPtr->joints[_index];
 }
 
 /////////////////////////////////////////////////
 const Joint *World::JointByName(const std::string &_name) const
 {
-  auto index = _name.rfind("::");
-  if (index != std::string::npos)
+  const std::string_view name = _name;
+  auto index = name.rfind("::");
+  if (index != std::string_view::npos)
   {
-    const Model *model = this->ModelByName(_name.substr(0, index));
+    const Model *model = this->ModelByNameView(name.substr(0, index));
     if (nullptr != model)
     {
-      return model->JointByName(_name.substr(index + 2));
+      return model->JointByNameView(name.substr(index + 2));
     }
 
     // The nested model name preceding the last "::" could not be found.
@@ -692,21 +725,27 @@ const Joint *World::JointByName(const std::string &_name) const
     return nullptr;
   }
 
-  for (auto const &f : this->dataPtr->joints)
-  {
-    if (f.Name() == _name)
-    {
-      return &f;
-    }
-  }
-  return nullptr;
+  return this->dataPtr->jointIndex.Find(this->dataPtr->joints, name);
 }
 
 /////////////////////////////////////////////////
 Joint *World::JointByName(const std::string &_name)
 {
-  return const_cast<Joint*>(
-      static_cast<const World*>(this)->JointByName(_name));
+  // The joint is marked as mutable in the index of the model or world
+  // that holds it, so the models are followed through mutable pointers.
+  auto index = _name.rfind("::");
+  if (index != std::string::npos)
+  {
+    Model *model = this->ModelByName(_name.substr(0, index));
+    if (nullptr != model)
+    {
+      return model->JointByName(_name.substr(index + 2));
+    }
+
+    // The nested model name preceding the last "::" could not be found.
+    return nullptr;
+  }
+  return this->dataPtr->jointIndex.FindMutable(this->dataPtr->joints, _name);
 }
 
 /////////////////////////////////////////////////
@@ -1147,6 +1186,7 @@ sdf::ElementPtr World::ToElement(const OutputConfig &_config) const
 void World::ClearModels()
 {
   this->dataPtr->models.clear();
+  this->dataPtr->modelIndex.Clear();
 }
 
 /////////////////////////////////////////////////
@@ -1159,6 +1199,7 @@ void World::ClearActors()
 void World::ClearJoints()
 {
   this->dataPtr->joints.clear();
+  this->dataPtr->jointIndex.Clear();
 }
 
 /////////////////////////////////////////////////
@@ -1177,6 +1218,7 @@ void World::ClearPhysics()
 void World::ClearFrames()
 {
   this->dataPtr->frames.clear();
+  this->dataPtr->frameIndex.Clear();
 }
 
 /////////////////////////////////////////////////
@@ -1195,6 +1237,7 @@ bool World::AddModel(const Model &_model)
   if (this->ModelNameExists(_model.Name()))
     return false;
   this->dataPtr->models.push_back(_model);
+  this->dataPtr->modelIndex.Add(this->dataPtr->models);
   return true;
 }
 
@@ -1214,6 +1257,7 @@ bool World::AddJoint(const Joint &_joint)
   if (this->JointNameExists(_joint.Name()))
     return false;
   this->dataPtr->joints.push_back(_joint);
+  this->dataPtr->jointIndex.Add(this->dataPtr->joints);
 
   return true;
 }
@@ -1244,6 +1288,7 @@ bool World::AddFrame(const Frame &_frame)
   if (this->FrameNameExists(_frame.Name()))
     return false;
   this->dataPtr->frames.push_back(_frame);
+  this->dataPtr->frameIndex.Add(this->dataPtr->frames);
 
   return true;
 }
@@ -23,6 +23,7 @@
 #include <gz/math/Inertial.hh>
 #include <gz/math/Pose3.hh>
 #include "sdf/Frame.hh"
+#include "sdf/Joint.hh"
 #include "sdf/Light.hh"
 #include "sdf/Actor.hh"
 #include "sdf/Model.hh"
@@ -413,6 +414,78 @@ TEST(DOMWorld, AddModel)
   EXPECT_EQ(modelFromWorld->Name(), model.Name());
 }
 
+/////////////////////////////////////////////////
+TEST(DOMWorld, LookupByName)
+{
+  const std::string sdfString = R"(
+  <sdf version="1.11">
+    <world name="default">
+      <frame name="world_frame"/>
+      <model name="parent">
+        <model name="child">
+          <link name="link"/>
+          <frame name="frame"/>
+          <joint name="joint" type="fixed">
+            <parent>world</parent>
+            <child>link</child>
+          </joint>
+        </model>
+      </model>
+      <model name="other">
+        <link name="link"/>
+      </model>
+      <joint name="world_joint" type="fixed">
+        <parent>world</parent>
+        <child>other::link</child>
+      </joint>
+    </world>
+  </sdf>)";
+
+  sdf::Root root;
+  sdf::Errors errors = root.LoadSdfString(sdfString);
+  EXPECT_TRUE(errors.empty()) << errors;
+  const sdf::World *world = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, world);
+
+  EXPECT_EQ(world->ModelByIndex(0), world->ModelByName("parent"));
+  EXPECT_EQ(world->ModelByIndex(1), world->ModelByName("other"));
+  ASSERT_NE(nullptr, world->ModelByName("parent::child"));
+  EXPECT_EQ("child", world->ModelByName("parent::child")->Name());
+  EXPECT_EQ(nullptr, world->ModelByName("parent::other"));
+
+  EXPECT_EQ(world->FrameByIndex(0), world->FrameByName("world_frame"));
+  ASSERT_NE(nullptr, world->FrameByName("parent::child::frame"));
+  EXPECT_EQ("frame", world->FrameByName("parent::child::frame")->Name());
+
+  EXPECT_EQ(world->JointByIndex(0), world->JointByName("world_joint"));
+  ASSERT_NE(nullptr, world->JointByName("parent::child::joint"));
+  EXPECT_EQ("joint", world->JointByName("parent::child::joint")->Name());
+  EXPECT_EQ(nullptr, world->JointByName("parent::joint"));
+
+  // Children added and cleared after the load are kept in the index
+  sdf::World copy(*world);
+  sdf::Joint joint;
+  joint.SetName("added_joint");
+  EXPECT_TRUE(copy.AddJoint(joint));
+  EXPECT_EQ(copy.JointByIndex(1), copy.JointByName("added_joint"));
+  copy.ClearJoints();
+  EXPECT_EQ(nullptr, copy.JointByName("world_joint"));
+  copy.ClearModels();
+  EXPECT_EQ(nullptr, copy.ModelByName("parent::child"));
+
+  // Children renamed through mutable pointers are found by their new name
+  sdf::World renamed(*world);
+  renamed.FrameByIndex(0)->SetName("renamed_frame");
+  EXPECT_EQ(nullptr, renamed.FrameByName("world_frame"));
+  EXPECT_EQ(renamed.FrameByIndex(0), renamed.FrameByName("renamed_frame"));
+  renamed.ModelByName("parent::child")->SetName("renamed_child");
+  EXPECT_EQ(nullptr, renamed.JointByName("parent::child::joint"));
+  EXPECT_NE(nullptr, renamed.JointByName("parent::renamed_child::joint"));
+  renamed.ModelByIndex(1)->SetName("parent");
+  EXPECT_EQ(renamed.ModelByIndex(0), renamed.ModelByName("parent"));
+  EXPECT_FALSE(renamed.ModelNameExists("other"));
+}
+
 /////////////////////////////////////////////////
 TEST(DOMWorld, AddModifyFrame)
 {
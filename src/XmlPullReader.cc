@@ -0,0 +1,751 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "XmlPullReader.hh"
+
+using namespace sdf;
+
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Check if a character is whitespace, as defined by tinyxml2.
+/// \param[in] _c The character.
+/// \return True if the character is whitespace.
+bool isWhitespace(char _c)
+{
+  return _c == ' ' || _c == '\t' || _c == '\n' || _c == '\v' ||
+         _c == '\f' || _c == '\r';
+}
+
+/////////////////////////////////////////////////
+/// \brief Check if a character can start a name.
+/// \param[in] _c The character.
+/// \return True if the character can start a name.
+bool isNameStartChar(char _c)
+{
+  const auto c = static_cast<unsigned char>(_c);
+  return c >= 128 || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         c == '_' || c == ':';
+}
+
+/////////////////////////////////////////////////
+/// \brief Check if a character can be part of a name.
+/// \param[in] _c The character.
+/// \return True if the character can be part of a name.
+bool isNameChar(char _c)
+{
+  return isNameStartChar(_c) || (_c >= '0' && _c <= '9') || _c == '.' ||
+         _c == '-';
+}
+
+/////////////////////////////////////////////////
+/// \brief Append a code point to a string, encoded as UTF-8.
+/// \param[in] _codePoint The code point.
+/// \param[out] _out The string to append to.
+/// \return False if the code point is not valid.
+bool appendUtf8(std::uint32_t _codePoint, std::string &_out)
+{
+  if (_codePoint == 0 || _codePoint > 0x10FFFF)
+    return false;
+
+  if (_codePoint < 0x80)
+  {
+    _out += static_cast<char>(_codePoint);
+  }
+  else if (_codePoint < 0x800)
+  {
+    _out += static_cast<char>(0xC0 | (_codePoint >> 6));
+    _out += static_cast<char>(0x80 | (_codePoint & 0x3F));
+  }
+  else if (_codePoint < 0x10000)
+  {
+    _out += static_cast<char>(0xE0 | (_codePoint >> 12));
+    _out += static_cast<char>(0x80 | ((_codePoint >> 6) & 0x3F));
+    _out += static_cast<char>(0x80 | (_codePoint & 0x3F));
+  }
+  else
+  {
+    _out += static_cast<char>(0xF0 | (_codePoint >> 18));
+    _out += static_cast<char>(0x80 | ((_codePoint >> 12) & 0x3F));
+    _out += static_cast<char>(0x80 | ((_codePoint >> 6) & 0x3F));
+    _out += static_cast<char>(0x80 | (_codePoint & 0x3F));
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// \brief Replace the entity at the start of a string.
+/// \param[in] _in Text that starts with '&'.
+/// \param[out] _out The string to append the replacement to.
+/// \return Length of the entity, or 0 if it is not a known entity, in which
+/// case it is kept as is.
+std::size_t replaceEntity(std::string_view _in, std::string &_out)
+{
+  static constexpr std::pair<std::string_view, char> kEntities[] = {
+    {"&quot;", '"'}, {"&amp;", '&'}, {"&apos;", '\''}, {"&lt;", '<'},
+    {"&gt;", '>'}};
+  for (const auto &[entity, value] : kEntities)
+  {
+    if (_in.substr(0, entity.size()) == entity)
+    {
+      _out += value;
+      return entity.size();
+    }
+  }
+
+  if (_in.size() < 4 || _in[1] != '#')
+    return 0;
+
+  const bool hex = _in[2] == 'x';
+  std::size_t i = hex ? 3 : 2;
+  const std::size_t first = i;
+  std::uint32_t codePoint = 0;
+  for (; i < _in.size() && _in[i] != ';'; ++i)
+  {
+    const char c = _in[i];
+    std::uint32_t digit = 0;
+    if (c >= '0' && c <= '9')
+      digit = c - '0';
+    else if (hex && c >= 'a' && c <= 'f')
+      digit = c - 'a' + 10;
+    else if (hex && c >= 'A' && c <= 'F')
+      digit = c - 'A' + 10;
+    else
+      return 0;
+
+    codePoint = codePoint * (hex ? 16 : 10) + digit;
+    if (codePoint > 0x10FFFF)
+      return 0;
+  }
+
+  if (i == first || i == _in.size())
+    return 0;
+
+  std::string utf8;
+  if (!appendUtf8(codePoint, utf8))
+    return 0;
+  _out += utf8;
+  return i + 1;
+}
+
+/////////////////////////////////////////////////
+/// \brief Replace the entities of a text and normalize its line breaks.
+/// \param[in] _in The text as written in the document.
+/// \param[in] _entities True to replace entities.
+/// \param[out] _out The text.
+void decodeText(std::string_view _in, bool _entities, std::string &_out)
+{
+  _out.clear();
+  _out.reserve(_in.size());
+  for (std::size_t i = 0; i < _in.size();)
+  {
+    const char c = _in[i];
+    if (c == '\r')
+    {
+      _out += '\n';
+      i += (i + 1 < _in.size() && _in[i + 1] == '\n') ? 2 : 1;
+    }
+    else if (c == '&' && _entities)
+    {
+      const std::size_t length = replaceEntity(_in.substr(i), _out);
+      if (length == 0)
+      {
+        _out += c;
+        ++i;
+      }
+      else
+      {
+        i += length;
+      }
+    }
+    else
+    {
+      _out += c;
+      ++i;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Trim a text and replace runs of whitespace with a single space.
+/// \param[in,out] _text The text.
+void collapseWhitespace(std::string &_text)
+{
+  std::size_t out = 0;
+  bool space = false;
+  for (const char c : _text)
+  {
+    if (isWhitespace(c))
+    {
+      space = out > 0;
+      continue;
+    }
+    if (space)
+    {
+      _text[out++] = ' ';
+      space = false;
+    }
+    _text[out++] = c;
+  }
+  _text.resize(out);
+}
+}
+
+/////////////////////////////////////////////////
+const char *XmlPullReader::XmlAttribute::Name() const
+{
+  return this->name.c_str();
+}
+
+/////////////////////////////////////////////////
+const char *XmlPullReader::XmlAttribute::Value() const
+{
+  return this->value.c_str();
+}
+
+/////////////////////////////////////////////////
+int XmlPullReader::XmlAttribute::GetLineNum() const
+{
+  return this->lineNumber;
+}
+
+/////////////////////////////////////////////////
+const XmlPullReader::XmlAttribute *XmlPullReader::XmlAttribute::Next() const
+{
+  return this->next;
+}
+
+/////////////////////////////////////////////////
+XmlPullReader::XmlPullReader(std::string_view _xml)
+  : xml(_xml)
+{
+  // Skip the UTF-8 byte order mark
+  if (this->xml.substr(0, 3) == "\xEF\xBB\xBF")
+    this->pos = 3;
+}
+
+/////////////////////////////////////////////////
+XmlPullReader::Event XmlPullReader::Next()
+{
+  if (this->failed)
+    return Event::INVALID;
+
+  if (this->emptyElement)
+  {
+    this->emptyElement = false;
+    this->attributes.clear();
+    return Event::END_ELEMENT;
+  }
+
+  const std::size_t textStart = this->pos;
+  const int textLine = this->line;
+  this->SkipWhitespace();
+
+  if (this->pos >= this->xml.size())
+  {
+    if (!this->openElements.empty())
+    {
+      return this->Fail("Element <" + this->openElements.back() +
+                        "> is not closed.");
+    }
+    if (!this->rootRead)
+      return this->Fail("Document is empty.");
+    return Event::END_DOCUMENT;
+  }
+
+  const std::string_view rest = this->xml.substr(this->pos);
+  if (rest[0] != '<')
+  {
+    if (this->openElements.empty())
+      return this->Fail("Text outside of the root element.");
+
+    // The text starts at the first character after the previous item,
+    // and its whitespace is then collapsed.
+    this->pos = textStart;
+    this->line = textLine;
+    const std::size_t end = this->xml.find('<', this->pos);
+    if (end == std::string_view::npos)
+    {
+      return this->Fail("Element <" + this->openElements.back() +
+                        "> is not closed.");
+    }
+
+    const std::string_view raw = this->xml.substr(this->pos, end - this->pos);
+    for (const char c : raw)
+    {
+      if (c == '\n')
+        ++this->line;
+    }
+    this->pos = end;
+    decodeText(raw, true, this->text);
+    collapseWhitespace(this->text);
+    return Event::TEXT;
+  }
+
+  std::string_view content;
+  if (rest.substr(0, 4) == "<!--")
+  {
+    this->pos += 4;
+    if (!this->SkipPast("-->", content))
+      return this->Fail("Comment is not closed.");
+    return Event::OTHER;
+  }
+
+  if (rest.substr(0, 9) == "<![CDATA[")
+  {
+    if (this->openElements.empty())
+      return this->Fail("CDATA section outside of the root element.");
+
+    this->pos += 9;
+    if (!this->SkipPast("]]>", content))
+      return this->Fail("CDATA section is not closed.");
+    decodeText(content, false, this->text);
+    return Event::TEXT;
+  }
+
+  if (rest.substr(0, 2) == "<?")
+  {
+    this->pos += 2;
+    if (!this->SkipPast("?>", content))
+      return this->Fail("Declaration is not closed.");
+    return Event::OTHER;
+  }
+
+  if (rest.substr(0, 2) == "<!")
+  {
+    this->pos += 2;
+    if (!this->SkipPast(">", content))
+      return this->Fail("Declaration is not closed.");
+    if (content.find('[') != std::string_view::npos)
+      return this->Fail("Internal DTD subsets are not supported.");
+    return Event::OTHER;
+  }
+
+  if (rest.substr(0, 2) == "</")
+  {
+    this->pos += 2;
+    return this->ReadEndTag();
+  }
+
+  this->tagOffset = this->pos;
+  ++this->pos;
+  return this->ReadStartTag();
+}
+
+/////////////////////////////////////////////////
+XmlPullReader::Event XmlPullReader::ReadStartTag()
+{
+  this->elementLine = this->line;
+  this->attributes.clear();
+  if (!this->ReadName(this->name))
+    return this->Fail("Invalid element name.");
+
+  while (true)
+  {
+    const std::size_t before = this->pos;
+    this->SkipWhitespace();
+    if (this->pos >= this->xml.size())
+      return this->Fail("Start tag of <" + this->name + "> is not closed.");
+
+    const char c = this->xml[this->pos];
+    if (c == '>' || c == '/')
+    {
+      if (c == '/')
+      {
+        if (this->xml.substr(this->pos, 2) != "/>")
+          return this->Fail("Invalid start tag of <" + this->name + ">.");
+        this->emptyElement = true;
+        ++this->pos;
+      }
+      ++this->pos;
+      break;
+    }
+
+    if (this->pos == before && !this->attributes.empty())
+      return this->Fail("Attributes of <" + this->name + "> are invalid.");
+
+    XmlAttribute attribute;
+    attribute.lineNumber = this->line;
+    if (!this->ReadName(attribute.name))
+      return this->Fail("Invalid attribute in <" + this->name + ">.");
+
+    this->SkipWhitespace();
+    if (this->pos >= this->xml.size() || this->xml[this->pos] != '=')
+    {
+      return this->Fail("Attribute [" + attribute.name + "] of <" +
+                        this->name + "> has no value.");
+    }
+    ++this->pos;
+    this->SkipWhitespace();
+
+    const char quote =
+        this->pos < this->xml.size() ? this->xml[this->pos] : '\0';
+    if (quote != '"' && quote != '\'')
+    {
+      return this->Fail("Value of attribute [" + attribute.name + "] of <" +
+                        this->name + "> is not quoted.");
+    }
+    ++this->pos;
+
+    std::string_view quoted;
+    if (!this->SkipPast(std::string_view(&quote, 1), quoted))
+    {
+      return this->Fail("Value of attribute [" + attribute.name + "] of <" +
+                        this->name + "> is not closed.");
+    }
+    decodeText(quoted, true, attribute.value);
+
+    for (const auto &other : this->attributes)
+    {
+      if (other.name == attribute.name)
+      {
+        return this->Fail("Attribute [" + attribute.name + "] of <" +
+                          this->name + "> is repeated.");
+      }
+    }
+    this->attributes.push_back(std::move(attribute));
+  }
+
+  // The attributes are linked once they stop moving
+  for (std::size_t i = 0; i + 1 < this->attributes.size(); ++i)
+    this->attributes[i].next = &this->attributes[i + 1];
+
+  if (this->openElements.empty())
+  {
+    if (this->rootRead)
+      return this->Fail("Document has more than one root element.");
+    this->rootRead = true;
+  }
+
+  if (!this->emptyElement)
+    this->openElements.push_back(this->name);
+  return Event::START_ELEMENT;
+}
+
+/////////////////////////////////////////////////
+XmlPullReader::Event XmlPullReader::ReadEndTag()
+{
+  this->elementLine = this->line;
+  this->attributes.clear();
+  if (!this->ReadName(this->name))
+    return this->Fail("Invalid end tag.");
+
+  this->SkipWhitespace();
+  if (this->pos >= this->xml.size() || this->xml[this->pos] != '>')
+    return this->Fail("End tag of <" + this->name + "> is not closed.");
+  ++this->pos;
+
+  if (this->openElements.empty() || this->openElements.back() != this->name)
+  {
+    return this->Fail("End tag of <" + this->name +
+                      "> does not match a start tag.");
+  }
+  this->openElements.pop_back();
+  return Event::END_ELEMENT;
+}
+
+/////////////////////////////////////////////////
+bool XmlPullReader::ReadName(std::string &_name)
+{
+  const std::size_t start = this->pos;
+  if (start >= this->xml.size() || !isNameStartChar(this->xml[start]))
+    return false;
+
+  std::size_t end = start + 1;
+  while (end < this->xml.size() && isNameChar(this->xml[end]))
+    ++end;
+
+  _name.assign(this->xml.substr(start, end - start));
+  this->pos = end;
+  return true;
+}
+
+/////////////////////////////////////////////////
+void XmlPullReader::SkipWhitespace()
+{
+  while (this->pos < this->xml.size() && isWhitespace(this->xml[this->pos]))
+  {
+    if (this->xml[this->pos] == '\n')
+      ++this->line;
+    ++this->pos;
+  }
+}
+
+/////////////////////////////////////////////////
+bool XmlPullReader::SkipPast(std::string_view _delimiter,
+                             std::string_view &_content)
+{
+  const std::size_t end = this->xml.find(_delimiter, this->pos);
+  if (end == std::string_view::npos)
+    return false;
+
+  _content = this->xml.substr(this->pos, end - this->pos);
+  for (const char c : _content)
+  {
+    if (c == '\n')
+      ++this->line;
+  }
+  this->pos = end + _delimiter.size();
+  return true;
+}
+
+/////////////////////////////////////////////////
+XmlPullReader::Event XmlPullReader::Fail(const std::string &_message)
+{
+  this->failed = true;
+  this->errorMessage = "Line " + std::to_string(this->line) + ": " + _message;
+  return Event::INVALID;
+}
+
+/////////////////////////////////////////////////
+const char *XmlPullReader::Value() const
+{
+  return this->name.c_str();
+}
+
+/////////////////////////////////////////////////
+int XmlPullReader::GetLineNum() const
+{
+  return this->elementLine;
+}
+
+/////////////////////////////////////////////////
+const XmlPullReader::XmlAttribute *XmlPullReader::FirstAttribute() const
+{
+  return this->attributes.empty() ? nullptr : &this->attributes.front();
+}
+
+/////////////////////////////////////////////////
+const char *XmlPullReader::Attribute(const char *_name) const
+{
+  for (const auto &attribute : this->attributes)
+  {
+    if (attribute.name == _name)
+      return attribute.value.c_str();
+  }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////
+const std::string &XmlPullReader::Text() const
+{
+  return this->text;
+}
+
+/////////////////////////////////////////////////
+const std::string &XmlPullReader::ErrorMessage() const
+{
+  return this->errorMessage;
+}
+
+/////////////////////////////////////////////////
+std::size_t XmlPullReader::Depth() const
+{
+  return this->openElements.size() + (this->emptyElement ? 1 : 0);
+}
+
+/////////////////////////////////////////////////
+std::size_t XmlPullReader::TagOffset() const
+{
+  return this->tagOffset;
+}
+
+/////////////////////////////////////////////////
+std::size_t XmlPullReader::Offset() const
+{
+  return this->pos;
+}
+
+/////////////////////////////////////////////////
+std::string_view XmlPullReader::Source(std::size_t _begin,
+                                       std::size_t _end) const
+{
+  return this->xml.substr(_begin, _end - _begin);
+}
+
+/////////////////////////////////////////////////
+void XmlPullReader::TakeAttributes(std::vector<XmlAttribute> &_attributes)
+{
+  // Swapping keeps the buffers, and so the links between the attributes
+  _attributes.swap(this->attributes);
+  this->attributes.clear();
+}
+
+/////////////////////////////////////////////////
+XmlStreamError::XmlStreamError(const std::string &_message)
+  : std::runtime_error(_message)
+{
+}
+
+/////////////////////////////////////////////////
+XmlStreamElement::XmlStreamElement(XmlPullReader &_reader)
+  : reader(_reader)
+{
+  this->Reset();
+}
+
+/////////////////////////////////////////////////
+XmlStreamElement::XmlStreamElement(XmlPullReader &_reader,
+                                   XmlStreamElement *_parent)
+  : reader(_reader), parent(_parent)
+{
+  this->Reset();
+}
+
+/////////////////////////////////////////////////
+void XmlStreamElement::Reset()
+{
+  this->name.assign(this->reader.Value());
+  this->lineNumber = this->reader.GetLineNum();
+  this->reader.TakeAttributes(this->attributes);
+  this->depth = this->reader.Depth() - 1;
+  this->beginOffset = this->reader.TagOffset();
+  this->endOffset = this->beginOffset;
+  this->started = false;
+  this->hasText = false;
+  this->pendingChild = false;
+  this->closed = false;
+}
+
+/////////////////////////////////////////////////
+const char *XmlStreamElement::Value() const
+{
+  return this->name.c_str();
+}
+
+/////////////////////////////////////////////////
+int XmlStreamElement::GetLineNum() const
+{
+  return this->lineNumber;
+}
+
+/////////////////////////////////////////////////
+const XmlPullReader::XmlAttribute *XmlStreamElement::FirstAttribute() const
+{
+  return this->attributes.empty() ? nullptr : &this->attributes.front();
+}
+
+/////////////////////////////////////////////////
+const char *XmlStreamElement::Attribute(const char *_name) const
+{
+  for (const auto *attribute = this->FirstAttribute(); attribute;
+       attribute = attribute->Next())
+  {
+    if (std::strcmp(attribute->Name(), _name) == 0)
+      return attribute->Value();
+  }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////
+const char *XmlStreamElement::GetText()
+{
+  if (!this->started)
+  {
+    this->started = true;
+    const XmlPullReader::Event event = this->Read();
+    if (event == XmlPullReader::Event::TEXT)
+    {
+      this->text = this->reader.Text();
+      this->hasText = true;
+    }
+    else if (event == XmlPullReader::Event::START_ELEMENT)
+    {
+      this->StartChild();
+      this->pendingChild = true;
+    }
+  }
+  return this->hasText ? this->text.c_str() : nullptr;
+}
+
+/////////////////////////////////////////////////
+XmlStreamElement *XmlStreamElement::FirstChildElement()
+{
+  this->started = true;
+  if (this->pendingChild)
+  {
+    this->pendingChild = false;
+    return this->child.get();
+  }
+  return this->ReadChild();
+}
+
+/////////////////////////////////////////////////
+XmlStreamElement *XmlStreamElement::NextSiblingElement()
+{
+  this->SkipRest();
+  return this->parent ? this->parent->ReadChild() : nullptr;
+}
+
+/////////////////////////////////////////////////
+std::string_view XmlStreamElement::ReadSource()
+{
+  this->SkipRest();
+  return this->reader.Source(this->beginOffset, this->endOffset);
+}
+
+/////////////////////////////////////////////////
+XmlPullReader::Event XmlStreamElement::Read()
+{
+  const XmlPullReader::Event event = this->reader.Next();
+  if (event == XmlPullReader::Event::INVALID)
+    throw XmlStreamError(this->reader.ErrorMessage());
+
+  if (event == XmlPullReader::Event::END_ELEMENT &&
+      this->reader.Depth() == this->depth)
+  {
+    this->closed = true;
+    this->endOffset = this->reader.Offset();
+  }
+  return event;
+}
+
+/////////////////////////////////////////////////
+XmlStreamElement *XmlStreamElement::ReadChild()
+{
+  while (!this->closed)
+  {
+    if (this->Read() == XmlPullReader::Event::START_ELEMENT)
+      return this->StartChild();
+  }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////
+XmlStreamElement *XmlStreamElement::StartChild()
+{
+  if (this->child)
+    this->child->Reset();
+  else
+    this->child.reset(new XmlStreamElement(this->reader, this));
+  return this->child.get();
+}
+
+/////////////////////////////////////////////////
+void XmlStreamElement::SkipRest()
+{
+  this->started = true;
+  this->pendingChild = false;
+  while (!this->closed)
+    this->Read();
+}
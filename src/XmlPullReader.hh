@@ -0,0 +1,367 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_XMLPULLREADER_HH_
+#define SDF_XMLPULLREADER_HH_
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sdf/sdf_config.h"
+
+namespace sdf
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace SDF_VERSION_NAMESPACE {
+
+  /// \internal
+  /// \brief Pull reader of XML documents, which reports the elements and
+  /// texts of a document one at a time instead of building a tree of nodes.
+  ///
+  /// Texts are read the way the parser configures tinyxml2: entities are
+  /// replaced, line breaks are normalized and whitespace is collapsed.
+  /// Documents that use a DTD with an internal subset are reported as
+  /// invalid. The reader does not own the document, which must outlive it.
+  class XmlPullReader
+  {
+    /// \brief Kind of an item of the document.
+    public: enum class Event
+    {
+      /// \brief Start tag of an element. An empty element, such as
+      /// <a/>, is reported as a start tag followed by an end tag.
+      START_ELEMENT,
+
+      /// \brief End tag of an element.
+      END_ELEMENT,
+
+      /// \brief Text or CDATA section in an element.
+      TEXT,
+
+      /// \brief Comment, processing instruction or declaration.
+      OTHER,
+
+      /// \brief End of a valid document.
+      END_DOCUMENT,
+
+      /// \brief The document is not valid XML. No other event follows.
+      INVALID
+    };
+
+    /// \brief Attribute of a start tag. The accessors mirror
+    /// tinyxml2::XMLAttribute, so that attributes can be read by the same
+    /// code.
+    public: class XmlAttribute
+    {
+      /// \brief Get the name of the attribute.
+      /// \return Name of the attribute.
+      public: const char *Name() const;
+
+      /// \brief Get the value of the attribute, with entities replaced.
+      /// \return Value of the attribute.
+      public: const char *Value() const;
+
+      /// \brief Get the line number of the attribute.
+      /// \return Line number, starting at 1.
+      public: int GetLineNum() const;
+
+      /// \brief Get the next attribute of the start tag.
+      /// \return The next attribute, or nullptr if this is the last one.
+      public: const XmlAttribute *Next() const;
+
+      /// \brief Name of the attribute.
+      private: std::string name;
+
+      /// \brief Value of the attribute.
+      private: std::string value;
+
+      /// \brief Line number of the attribute.
+      private: int lineNumber = 0;
+
+      /// \brief Next attribute, nullptr for the last one.
+      private: const XmlAttribute *next = nullptr;
+
+      friend class XmlPullReader;
+    };
+
+    /// \brief Constructor.
+    /// \param[in] _xml The document to read.
+    public: explicit XmlPullReader(std::string_view _xml);
+
+    /// \brief Read the next item of the document.
+    /// \return The kind of the item.
+    public: Event Next();
+
+    /// \brief Get the name of the current element, for START_ELEMENT and
+    /// END_ELEMENT events.
+    /// \return Name of the element.
+    public: const char *Value() const;
+
+    /// \brief Get the line number of the current element, for
+    /// START_ELEMENT and END_ELEMENT events.
+    /// \return Line number of the start tag, starting at 1.
+    public: int GetLineNum() const;
+
+    /// \brief Get the first attribute of the current start tag.
+    /// \return The first attribute, or nullptr if there is none.
+    public: const XmlAttribute *FirstAttribute() const;
+
+    /// \brief Get the value of an attribute of the current start tag.
+    /// \param[in] _name Name of the attribute.
+    /// \return Value of the attribute, or nullptr if there is none.
+    public: const char *Attribute(const char *_name) const;
+
+    /// \brief Get the current text, for TEXT events.
+    /// \return The text.
+    public: const std::string &Text() const;
+
+    /// \brief Get a description of the problem, for INVALID events.
+    /// \return Error message.
+    public: const std::string &ErrorMessage() const;
+
+    /// \brief Get the number of elements that contain the current item.
+    /// For a start tag, this includes its element, even if it is empty.
+    /// \return Depth of the current item, 0 outside of the root element.
+    public: std::size_t Depth() const;
+
+    /// \brief Get the offset of the current start tag, for START_ELEMENT
+    /// events.
+    /// \return Offset of the '<' of the start tag in the document.
+    public: std::size_t TagOffset() const;
+
+    /// \brief Get the offset of the end of the current item.
+    /// \return Offset of the first character after the item.
+    public: std::size_t Offset() const;
+
+    /// \brief Get a part of the document, as written in it.
+    /// \param[in] _begin Offset of the first character.
+    /// \param[in] _end Offset of the character after the last one.
+    /// \return The part of the document.
+    public: std::string_view Source(std::size_t _begin,
+                                    std::size_t _end) const;
+
+    /// \brief Move the attributes of the current start tag, which stay
+    /// linked to each other, into a vector. The reader then has none.
+    /// \param[in,out] _attributes The vector, whose previous contents are
+    /// discarded.
+    public: void TakeAttributes(std::vector<XmlAttribute> &_attributes);
+
+    /// \brief Read a start tag, after its '<'.
+    /// \return The event to report.
+    private: Event ReadStartTag();
+
+    /// \brief Read an end tag, after its "</".
+    /// \return The event to report.
+    private: Event ReadEndTag();
+
+    /// \brief Read a name at the current position.
+    /// \param[out] _name The name.
+    /// \return True if a name was read.
+    private: bool ReadName(std::string &_name);
+
+    /// \brief Skip whitespace, counting the lines.
+    private: void SkipWhitespace();
+
+    /// \brief Skip to the end of a delimiter, counting the lines.
+    /// \param[in] _delimiter The delimiter to skip to.
+    /// \param[out] _content The text before the delimiter.
+    /// \return True if the delimiter was found.
+    private: bool SkipPast(std::string_view _delimiter,
+                          std::string_view &_content);
+
+    /// \brief Report that the document is not valid.
+    /// \param[in] _message Description of the problem.
+    /// \return The INVALID event.
+    private: Event Fail(const std::string &_message);
+
+    /// \brief The document.
+    private: std::string_view xml;
+
+    /// \brief Position of the next item in the document.
+    private: std::size_t pos = 0;
+
+    /// \brief Current line number.
+    private: int line = 1;
+
+    /// \brief Names of the open elements.
+    private: std::vector<std::string> openElements;
+
+    /// \brief Name of the current element.
+    private: std::string name;
+
+    /// \brief Line number of the current element.
+    private: int elementLine = 0;
+
+    /// \brief Offset of the current start tag.
+    private: std::size_t tagOffset = 0;
+
+    /// \brief Attributes of the current start tag.
+    private: std::vector<XmlAttribute> attributes;
+
+    /// \brief Current text.
+    private: std::string text;
+
+    /// \brief Error message.
+    private: std::string errorMessage;
+
+    /// \brief True if the current start tag closes its element, e.g. <a/>.
+    private: bool emptyElement = false;
+
+    /// \brief True once the root element has been read.
+    private: bool rootRead = false;
+
+    /// \brief True after an INVALID event.
+    private: bool failed = false;
+  };
+
+  /// \internal
+  /// \brief Thrown by XmlStreamElement when the document is not valid XML.
+  class XmlStreamError : public std::runtime_error
+  {
+    /// \brief Constructor.
+    /// \param[in] _message Description of the problem.
+    public: explicit XmlStreamError(const std::string &_message);
+  };
+
+  /// \internal
+  /// \brief Element of a document read by an XmlPullReader. Its accessors
+  /// mirror the part of tinyxml2::XMLElement used to read SDFormat
+  /// documents, so that elements are read by the same code whether or not
+  /// a tinyxml2 document is built.
+  ///
+  /// The elements of the document are only read forward. The text of an
+  /// element must be read before its children, and a child must not be used
+  /// once the next one is read. The object of a child is reused for its
+  /// siblings, so that only the elements that contain the current one are
+  /// kept in memory. XmlStreamError is thrown if the document is found not
+  /// to be valid XML.
+  class XmlStreamElement
+  {
+    /// \brief Constructor. Reads the element of the current start tag.
+    /// \param[in] _reader Reader whose last event is START_ELEMENT. It must
+    /// outlive the element.
+    public: explicit XmlStreamElement(XmlPullReader &_reader);
+
+    /// \brief Get the name of the element.
+    /// \return Name of the element.
+    public: const char *Value() const;
+
+    /// \brief Get the line number of the start tag.
+    /// \return Line number, starting at 1.
+    public: int GetLineNum() const;
+
+    /// \brief Get the first attribute of the element.
+    /// \return The first attribute, or nullptr if there is none.
+    public: const XmlPullReader::XmlAttribute *FirstAttribute() const;
+
+    /// \brief Get the value of an attribute of the element.
+    /// \param[in] _name Name of the attribute.
+    /// \return Value of the attribute, or nullptr if there is none.
+    public: const char *Attribute(const char *_name) const;
+
+    /// \brief Get the text of the element, if its first child is a text,
+    /// as tinyxml2::XMLElement::GetText().
+    /// \return The text, or nullptr if there is none.
+    public: const char *GetText();
+
+    /// \brief Read the first child element.
+    /// \return The first child, or nullptr if there is none.
+    public: XmlStreamElement *FirstChildElement();
+
+    /// \brief Skip the rest of this element, and read the next sibling.
+    /// \return This object, set to the next sibling, or nullptr if there is
+    /// none.
+    public: XmlStreamElement *NextSiblingElement();
+
+    /// \brief Skip the rest of this element, and get its source.
+    /// \return The element, from its start tag to its end tag, as written
+    /// in the document.
+    public: std::string_view ReadSource();
+
+    /// \brief Constructor of a child element.
+    /// \param[in] _reader The reader.
+    /// \param[in] _parent The parent element.
+    private: XmlStreamElement(XmlPullReader &_reader,
+                              XmlStreamElement *_parent);
+
+    /// \brief Set this object to the element of the current start tag.
+    private: void Reset();
+
+    /// \brief Read the next item of the document.
+    /// \return The kind of the item, which is not INVALID.
+    private: XmlPullReader::Event Read();
+
+    /// \brief Read up to the next child element.
+    /// \return The child, or nullptr if the element has no more children.
+    private: XmlStreamElement *ReadChild();
+
+    /// \brief Set the child object to the element of the current start
+    /// tag.
+    /// \return The child.
+    private: XmlStreamElement *StartChild();
+
+    /// \brief Read up to the end tag of the element.
+    private: void SkipRest();
+
+    /// \brief The reader.
+    private: XmlPullReader &reader;
+
+    /// \brief The parent element, nullptr for the root element.
+    private: XmlStreamElement *parent = nullptr;
+
+    /// \brief The current child element.
+    private: std::unique_ptr<XmlStreamElement> child;
+
+    /// \brief Name of the element.
+    private: std::string name;
+
+    /// \brief Line number of the start tag.
+    private: int lineNumber = 0;
+
+    /// \brief Attributes of the element.
+    private: std::vector<XmlPullReader::XmlAttribute> attributes;
+
+    /// \brief Text of the element.
+    private: std::string text;
+
+    /// \brief Depth of the parent element.
+    private: std::size_t depth = 0;
+
+    /// \brief Offset of the start tag.
+    private: std::size_t beginOffset = 0;
+
+    /// \brief Offset of the end of the end tag, once it is read.
+    private: std::size_t endOffset = 0;
+
+    /// \brief True once the items after the start tag are read.
+    private: bool started = false;
+
+    /// \brief True if the first child is a text.
+    private: bool hasText = false;
+
+    /// \brief True if the start tag of the first child was read by
+    /// GetText().
+    private: bool pendingChild = false;
+
+    /// \brief True once the end tag is read.
+    private: bool closed = false;
+  };
+  }
+}
+#endif
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "XmlPullReader.hh"
+
+using Event = sdf::XmlPullReader::Event;
+
+/////////////////////////////////////////////////
+TEST(XmlPullReader, Elements)
+{
+  const std::string xml =
+      "<?xml version='1.0'?>\n"
+      "<!-- comment -->\n"
+      "<sdf version=\"1.11\">\n"
+      "  <model name='a&amp;b'\n"
+      "         canonical_link=\"link\">\n"
+      "    <pose>  1 2\n 3   0 0 0 </pose>\n"
+      "    <static/>\n"
+      "    <plugin><![CDATA[ <raw> ]]></plugin>\n"
+      "  </model>\n"
+      "</sdf>\n";
+
+  sdf::XmlPullReader reader(xml);
+  EXPECT_EQ(Event::OTHER, reader.Next());
+  EXPECT_EQ(Event::OTHER, reader.Next());
+
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("sdf", reader.Value());
+  EXPECT_EQ(3, reader.GetLineNum());
+  EXPECT_STREQ("1.11", reader.Attribute("version"));
+  EXPECT_EQ(nullptr, reader.Attribute("name"));
+
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("model", reader.Value());
+  EXPECT_EQ(4, reader.GetLineNum());
+  const auto *attribute = reader.FirstAttribute();
+  ASSERT_NE(nullptr, attribute);
+  EXPECT_STREQ("name", attribute->Name());
+  EXPECT_STREQ("a&b", attribute->Value());
+  EXPECT_EQ(4, attribute->GetLineNum());
+  attribute = attribute->Next();
+  ASSERT_NE(nullptr, attribute);
+  EXPECT_STREQ("canonical_link", attribute->Name());
+  EXPECT_EQ(5, attribute->GetLineNum());
+  EXPECT_EQ(nullptr, attribute->Next());
+
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("pose", reader.Value());
+  EXPECT_EQ(6, reader.GetLineNum());
+  ASSERT_EQ(Event::TEXT, reader.Next());
+  EXPECT_EQ("1 2 3 0 0 0", reader.Text());
+  EXPECT_EQ(Event::END_ELEMENT, reader.Next());
+
+  // Empty elements have an end tag
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+  EXPECT_STREQ("static", reader.Value());
+  EXPECT_EQ(8, reader.GetLineNum());
+  ASSERT_EQ(Event::END_ELEMENT, reader.Next());
+  EXPECT_STREQ("static", reader.Value());
+
+  // CDATA sections are not collapsed
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+  ASSERT_EQ(Event::TEXT, reader.Next());
+  EXPECT_EQ(" <raw> ", reader.Text());
+  EXPECT_EQ(Event::END_ELEMENT, reader.Next());
+
+  ASSERT_EQ(Event::END_ELEMENT, reader.Next());
+  EXPECT_STREQ("model", reader.Value());
+  ASSERT_EQ(Event::END_ELEMENT, reader.Next());
+  EXPECT_STREQ("sdf", reader.Value());
+  EXPECT_EQ(Event::END_DOCUMENT, reader.Next());
+  EXPECT_EQ(Event::END_DOCUMENT, reader.Next());
+}
+
+/////////////////////////////////////////////////
+TEST(XmlPullReader, Entities)
+{
+  sdf::XmlPullReader reader(
+      "<a>&lt;&#65;&#x42;&unknown; &gt;\r\n&quot;&apos;</a>");
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+  ASSERT_EQ(Event::TEXT, reader.Next());
+  EXPECT_EQ("<AB&unknown; > \"'", reader.Text());
+}
+
+/////////////////////////////////////////////////
+TEST(XmlPullReader, Invalid)
+{
+  for (const std::string xml : {
+      "", "<a>", "<a></b>", "<a x='1' x='2'/>", "<a x=1/>", "<a/><b/>",
+      "text<a/>", "<a><!-- </a>", "<!DOCTYPE a [<!ENTITY b 'c'>]><a/>",
+      "<a x='1'y='2'/>", "<1a/>"})
+  {
+    sdf::XmlPullReader reader(xml);
+    Event event = Event::OTHER;
+    while (event != Event::INVALID && event != Event::END_DOCUMENT)
+      event = reader.Next();
+    EXPECT_EQ(Event::INVALID, event) << xml;
+    EXPECT_FALSE(reader.ErrorMessage().empty()) << xml;
+    EXPECT_EQ(Event::INVALID, reader.Next());
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(XmlStreamElement, Children)
+{
+  const std::string xml =
+      "<?xml version='1.0'?>\n"
+      "<sdf version='1.11'>\n"
+      "  <model name='model'>\n"
+      "    <link name='a'><pose>1 2 3 0 0 0</pose></link>\n"
+      "    <link name='b'/>\n"
+      "    <plugin name='p'><x a='1'>y</x></plugin>\n"
+      "    <static><!-- c -->true</static>\n"
+      "  </model>\n"
+      "</sdf>\n";
+
+  sdf::XmlPullReader reader(xml);
+  while (reader.Next() != Event::START_ELEMENT)
+  {
+  }
+
+  sdf::XmlStreamElement root(reader);
+  EXPECT_STREQ("sdf", root.Value());
+  EXPECT_EQ(2, root.GetLineNum());
+  EXPECT_STREQ("1.11", root.Attribute("version"));
+  EXPECT_EQ(nullptr, root.GetText());
+
+  // The first child was read by GetText()
+  sdf::XmlStreamElement *model = root.FirstChildElement();
+  ASSERT_NE(nullptr, model);
+  EXPECT_STREQ("model", model->Value());
+  EXPECT_EQ(3, model->GetLineNum());
+  ASSERT_NE(nullptr, model->FirstAttribute());
+  EXPECT_STREQ("name", model->FirstAttribute()->Name());
+  EXPECT_STREQ("model", model->FirstAttribute()->Value());
+  EXPECT_EQ(nullptr, model->FirstAttribute()->Next());
+
+  // The children of the first link are skipped
+  sdf::XmlStreamElement *link = model->FirstChildElement();
+  ASSERT_NE(nullptr, link);
+  EXPECT_STREQ("a", link->Attribute("name"));
+  EXPECT_EQ(4, link->GetLineNum());
+
+  // The object of a child is reused for its siblings
+  EXPECT_EQ(link, link->NextSiblingElement());
+  EXPECT_STREQ("link", link->Value());
+  EXPECT_STREQ("b", link->Attribute("name"));
+  EXPECT_EQ(5, link->GetLineNum());
+  EXPECT_EQ(nullptr, link->GetText());
+  EXPECT_EQ(nullptr, link->FirstChildElement());
+
+  sdf::XmlStreamElement *plugin = link->NextSiblingElement();
+  ASSERT_NE(nullptr, plugin);
+  EXPECT_STREQ("plugin", plugin->Value());
+  EXPECT_EQ("<plugin name='p'><x a='1'>y</x></plugin>",
+            plugin->ReadSource());
+
+  // A comment before the text hides it, as in tinyxml2
+  sdf::XmlStreamElement *isStatic = plugin->NextSiblingElement();
+  ASSERT_NE(nullptr, isStatic);
+  EXPECT_STREQ("static", isStatic->Value());
+  EXPECT_EQ(nullptr, isStatic->GetText());
+  EXPECT_EQ(nullptr, isStatic->NextSiblingElement());
+
+  // The end tag of the root element is read with the last sibling
+  EXPECT_EQ(nullptr, model->NextSiblingElement());
+  const std::size_t begin = xml.find("<sdf");
+  const std::size_t end = xml.rfind('>') + 1;
+  EXPECT_EQ(xml.substr(begin, end - begin), root.ReadSource());
+  EXPECT_EQ(Event::END_DOCUMENT, reader.Next());
+}
+
+/////////////////////////////////////////////////
+TEST(XmlStreamElement, Text)
+{
+  sdf::XmlPullReader reader(
+      "<pose relative_to='a'>  1 2\n 3 0 0 0 </pose>");
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+
+  sdf::XmlStreamElement pose(reader);
+  EXPECT_STREQ("a", pose.Attribute("relative_to"));
+  ASSERT_NE(nullptr, pose.GetText());
+  EXPECT_STREQ("1 2 3 0 0 0", pose.GetText());
+  EXPECT_EQ(nullptr, pose.FirstChildElement());
+  EXPECT_EQ("<pose relative_to='a'>  1 2\n 3 0 0 0 </pose>",
+            pose.ReadSource());
+  EXPECT_EQ(Event::END_DOCUMENT, reader.Next());
+}
+
+/////////////////////////////////////////////////
+TEST(XmlStreamElement, Invalid)
+{
+  sdf::XmlPullReader reader("<sdf><model><link></model></sdf>");
+  ASSERT_EQ(Event::START_ELEMENT, reader.Next());
+
+  sdf::XmlStreamElement root(reader);
+  sdf::XmlStreamElement *model = root.FirstChildElement();
+  ASSERT_NE(nullptr, model);
+  EXPECT_THROW(model->NextSiblingElement(), sdf::XmlStreamError);
+}
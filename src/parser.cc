@@ -15,12 +15,21 @@
  *
  */
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
 #include <gz/math/SemanticVersion.hh>
 
@@ -40,10 +49,17 @@
 #include "sdf/sdf_config.h"
 
 #include "Converter.hh"
+#include "ElementArena.hh"
+#include "EmbeddedSdf.hh"
 #include "FrameSemantics.hh"
+#include "IncludeCache.hh"
+#include "IncludeThreadPool.hh"
+#include "MappedFile.hh"
 #include "ParamPassing.hh"
+#include "ParserConfigCaches.hh"
 #include "ScopedGraph.hh"
 #include "Utils.hh"
+#include "XmlPullReader.hh"
 #include "parser_private.hh"
 #include "parser_urdf.hh"
 
@@ -86,6 +102,84 @@ struct SourceLocation
     }
   }
 };
+
+//////////////////////////////////////////////////
+/// \brief Document parsed from the source of an element of a streamed
+/// document, e.g. an <include>, which is read from a tinyxml2 element.
+/// Its line numbers are those of the streamed document.
+class XmlSliceDocument : public tinyxml2::XMLDocument
+{
+  /// \brief Constructor, with the settings of the other documents.
+  public: XmlSliceDocument()
+    : tinyxml2::XMLDocument(true, tinyxml2::COLLAPSE_WHITESPACE)
+  {
+  }
+
+  /// \brief Parse the source of an element.
+  /// \param[in] _xml Source of the element.
+  /// \param[in] _lineNumber Line number of the start tag of the element in
+  /// the streamed document.
+  /// \return True if the element was parsed.
+  public: bool ParseElement(std::string_view _xml, int _lineNumber)
+  {
+    if (this->Parse(_xml.data(), _xml.size()) != tinyxml2::XML_SUCCESS)
+      return false;
+
+    this->lineOffset = _lineNumber - 1;
+    this->OffsetLineNumbers(this);
+    return true;
+  }
+
+  /// \brief Get the line number of an attribute. tinyxml2 does not let the
+  /// line numbers of attributes be changed, so those of a parsed element
+  /// are offset when they are read.
+  /// \param[in] _xml Element of the attribute.
+  /// \param[in] _attribute The attribute.
+  /// \return Line number of the attribute in the document it was read from.
+  public: static int LineNumber(const tinyxml2::XMLElement *_xml,
+                                const tinyxml2::XMLAttribute *_attribute)
+  {
+    const auto *doc =
+        dynamic_cast<const XmlSliceDocument *>(_xml->GetDocument());
+    return _attribute->GetLineNum() + (doc ? doc->lineOffset : 0);
+  }
+
+  /// \brief Offset the line numbers of the descendants of a node.
+  /// \param[in,out] _node The node.
+  private: void OffsetLineNumbers(tinyxml2::XMLNode *_node) const
+  {
+    for (tinyxml2::XMLNode *child = _node->FirstChild(); child;
+         child = child->NextSibling())
+    {
+      child->*(&XmlSliceDocument::_parseLineNum) += this->lineOffset;
+      this->OffsetLineNumbers(child);
+    }
+  }
+
+  /// \brief Number of lines before the element in the streamed document.
+  private: int lineOffset = 0;
+};
+
+//////////////////////////////////////////////////
+/// \brief Thrown while streaming a document whose top level pose is not
+/// valid, to stop reading it as when checkXmlFromRoot() fails.
+struct TopLevelCheckError
+{
+};
+
+//////////////////////////////////////////////////
+/// \brief Result of reading a document with the streaming reader.
+enum class StreamedRead
+{
+  /// \brief The document was read.
+  READ,
+
+  /// \brief The document could not be read.
+  FAILED,
+
+  /// \brief The document must be read by readDoc(). Nothing was reported.
+  NOT_STREAMED
+};
 }
 //////////////////////////////////////////////////
 /// \brief Internal helper for readFile, which populates the SDF values
@@ -120,12 +214,34 @@ bool readFileInternal(
 /// \param[out] _errors Parsing errors will be appended to this variable.
 /// \return True if successful.
 bool readStringInternal(
-    const std::string &_xmlString,
+    std::string_view _xmlString,
     const bool _convert,
     const ParserConfig &_config,
     SDFPtr _sdf,
     Errors &_errors);
 
+/// \brief Read a document with the streaming reader of
+/// ParserConfig::SetStreamingParsing(), which builds the elements while it
+/// reads the XML, instead of first building a tinyxml2 document.
+///
+/// Documents whose root is not <sdf>, that have no version, that must be
+/// converted to the latest version, or whose prolog is not valid XML are
+/// not streamed, and are left to readDoc() before anything is reported.
+/// \param[in] _xml The document. It is read in place.
+/// \param[out] _sdf Pointer to an SDF object.
+/// \param[in] _source Source of the document.
+/// \param[in] _convert Convert to the latest version if true.
+/// \param[in] _config Custom parser configuration
+/// \param[out] _errors Parsing errors will be appended to this variable.
+/// \return Whether the document was read.
+static StreamedRead readDocStream(
+    std::string_view _xml,
+    SDFPtr _sdf,
+    const std::string &_source,
+    const bool _convert,
+    const ParserConfig &_config,
+    Errors &_errors);
+
 //////////////////////////////////////////////////
 /// \brief Internal helper for creating XMLDocuments
 ///
@@ -154,6 +270,130 @@ static bool isSdfFile(const std::string &_fileName)
   return false;
 }
 
+//////////////////////////////////////////////////
+/// \brief Initialize an element from a precompiled spec description. This is
+/// the equivalent of initXml for the tables generated by sdf/embedSdf.py, and
+/// does not parse any XML.
+/// \param[in,out] _sdf Element to initialize.
+/// \param[in] _desc Precompiled description of the element.
+/// \param[in] _config Custom parser configuration
+static void initEmbeddedElement(ElementPtr _sdf,
+                                const EmbeddedSdfElement &_desc,
+                                const ParserConfig &_config)
+{
+  if (_desc.ref)
+  {
+    _sdf->SetReferenceSDF(_desc.ref);
+  }
+  _sdf->SetName(_desc.name);
+  _sdf->SetRequired(_desc.required);
+
+  if (_desc.type)
+  {
+    const bool required = std::string(_desc.required) == "1";
+    _sdf->AddValue(_desc.type, _desc.defaultValue, required, _desc.minValue,
+                   _desc.maxValue, _desc.description ? _desc.description : "");
+  }
+
+  for (std::size_t i = 0; i < _desc.attributeCount; ++i)
+  {
+    const EmbeddedSdfAttribute &attribute = _desc.attributes[i];
+    _sdf->AddAttribute(attribute.name, attribute.type, attribute.defaultValue,
+                       attribute.required, attribute.description);
+  }
+
+  if (_desc.description)
+  {
+    _sdf->SetDescription(_desc.description);
+  }
+
+  if (_desc.copyChildren)
+  {
+    _sdf->SetCopyChildren(true);
+  }
+
+  for (std::size_t i = 0; i < _desc.elementCount; ++i)
+  {
+    ElementPtr element(new Element);
+    initEmbeddedElement(element, _desc.elements[i], _config);
+    _sdf->AddElementDescription(element);
+  }
+
+  for (std::size_t i = 0; i < _desc.includeCount; ++i)
+  {
+    ElementPtr element(new Element);
+    initFile(_desc.includes[i].filename, _config, element);
+
+    // override description for include elements
+    if (_desc.includes[i].description)
+    {
+      element->SetDescription(_desc.includes[i].description);
+    }
+    _sdf->AddElementDescription(element);
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Initialize an element from one of the embedded spec files.
+///
+/// The element description tree of each spec version and file name is built
+/// once per process from the precompiled tables generated by sdf/embedSdf.py
+/// and kept in a cache. Subsequent calls copy the cached tree into _sdf.
+/// \param[in] _filename Name of the embedded spec file, e.g. "root.sdf".
+/// \param[in] _quiet True to suppress the error printed if the spec file
+/// is not found.
+/// \param[in] _config Custom parser configuration
+/// \param[in,out] _sdf Element to initialize.
+/// \param[out] _errors Captures errors encountered during initialization.
+/// \return True on success.
+static bool initEmbeddedSpec(const std::string &_filename, const bool _quiet,
+                             const ParserConfig &_config, ElementPtr _sdf,
+                             sdf::Errors &_errors)
+{
+  static std::mutex cacheMutex;
+  static std::map<std::string, ElementPtr> cache;
+
+  const std::string key = SDF::Version() + "/" + _filename;
+  ElementPtr desc;
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(key);
+    if (it != cache.end())
+      desc = it->second;
+  }
+
+  if (!desc)
+  {
+    const auto &descriptions = GetEmbeddedSdfDescriptions();
+    auto it = descriptions.find(key);
+    if (it == descriptions.end())
+    {
+      // There is no precompiled description for this file, so parse the
+      // embedded spec XML, if any.
+      auto xmlDoc = makeSdfDoc();
+      xmlDoc.Parse(SDF::EmbeddedSpec(_filename, _quiet).c_str());
+      return initDoc(_errors, _sdf, &xmlDoc, _config);
+    }
+
+    // The lock is not held while building, since spec files include other
+    // spec files that are resolved through this same cache. The cached tree
+    // outlives the document being read, so it is never allocated from the
+    // arena of that document.
+    ElementArenaScope heapScope(nullptr);
+    desc.reset(new Element);
+    initEmbeddedElement(desc, *it->second, _config);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    desc = cache.emplace(key, desc).first->second;
+  }
+
+  // The cached tree is shared by all threads and must never be modified, so
+  // hand out a copy of it.
+  const std::size_t errorCount = _errors.size();
+  _sdf->Copy(desc, _errors);
+  return _errors.size() == errorCount;
+}
+
 //////////////////////////////////////////////////
 template <typename TPtr>
 static inline bool _initFile(const std::string &_filename,
@@ -427,10 +667,7 @@ bool init(SDFPtr _sdf, const ParserConfig &_config)
 //////////////////////////////////////////////////
 bool init(sdf::Errors &_errors, SDFPtr _sdf, const ParserConfig &_config)
 {
-  std::string xmldata = SDF::EmbeddedSpec("root.sdf", false);
-  auto xmlDoc = makeSdfDoc();
-  xmlDoc.Parse(xmldata.c_str());
-  return initDoc(_errors, _sdf, &xmlDoc, _config);
+  return initEmbeddedSpec("root.sdf", false, _config, _sdf->Root(), _errors);
 }
 
 //////////////////////////////////////////////////
@@ -453,12 +690,9 @@ bool initFile(const std::string &_filename, const ParserConfig &_config,
 bool initFile(const std::string &_filename, const ParserConfig &_config,
               SDFPtr _sdf, sdf::Errors &_errors)
 {
-  std::string xmldata = SDF::EmbeddedSpec(_filename, true);
-  if (!xmldata.empty())
+  if (!SDF::EmbeddedSpec(_filename, true).empty())
   {
-    auto xmlDoc = makeSdfDoc();
-    xmlDoc.Parse(xmldata.c_str());
-    return initDoc(_errors, _sdf, &xmlDoc, _config);
+    return initEmbeddedSpec(_filename, true, _config, _sdf->Root(), _errors);
   }
   return _initFile(sdf::findFile(_filename, true, false, _config), _config,
                    _sdf, _errors);
@@ -484,12 +718,9 @@ bool initFile(
 bool initFile(const std::string &_filename, const ParserConfig &_config,
               ElementPtr _sdf, sdf::Errors &_errors)
 {
-  std::string xmldata = SDF::EmbeddedSpec(_filename, true);
-  if (!xmldata.empty())
+  if (!SDF::EmbeddedSpec(_filename, true).empty())
   {
-    auto xmlDoc = makeSdfDoc();
-    xmlDoc.Parse(xmldata.c_str());
-    return initDoc(_errors, _sdf, &xmlDoc, _config);
+    return initEmbeddedSpec(_filename, true, _config, _sdf, _errors);
   }
   return _initFile(sdf::findFile(_filename, true, false, _config), _config,
                    _sdf, _errors);
@@ -819,6 +1050,8 @@ bool readFileWithoutConversion(const std::string &_filename,
 bool readFileInternal(const std::string &_filename, const bool _convert,
     const ParserConfig &_config, SDFPtr _sdf, Errors &_errors)
 {
+  ElementArenaScope arenaScope(_config);
+  IncludeThreadPoolScope threadPoolScope(_config);
   auto xmlDoc = makeSdfDoc();
   std::string filename = sdf::findFile(_filename, true, true, _config);
 
@@ -841,6 +1074,19 @@ bool readFileInternal(const std::string &_filename, const bool _convert,
     return false;
   }
 
+  if (_config.StreamingParsing())
+  {
+    // The streaming reader reads the mapping of the file in place
+    const MappedFile file(filename);
+    if (file.Valid())
+    {
+      const StreamedRead read = readDocStream(
+          file.Data(), _sdf, filename, _convert, _config, _errors);
+      if (read != StreamedRead::NOT_STREAMED)
+        return read == StreamedRead::READ;
+    }
+  }
+
   auto error_code = xmlDoc.LoadFile(filename.c_str());
   if (error_code)
   {
@@ -914,6 +1160,20 @@ bool readString(const std::string &_xmlString, const ParserConfig &_config,
   return readStringInternal(_xmlString, true, _config, _sdf, _errors);
 }
 
+//////////////////////////////////////////////////
+bool readString(std::string_view _xmlString, const ParserConfig &_config,
+    SDFPtr _sdf, Errors &_errors)
+{
+  return readStringInternal(_xmlString, true, _config, _sdf, _errors);
+}
+
+//////////////////////////////////////////////////
+bool readString(const char *_xmlString, const ParserConfig &_config,
+    SDFPtr _sdf, Errors &_errors)
+{
+  return readStringInternal(_xmlString, true, _config, _sdf, _errors);
+}
+
 //////////////////////////////////////////////////
 bool readStringWithoutConversion(
     const std::string &_filename, SDFPtr _sdf, Errors &_errors)
@@ -930,11 +1190,21 @@ bool readStringWithoutConversion(const std::string &_filename,
 }
 
 //////////////////////////////////////////////////
-bool readStringInternal(const std::string &_xmlString, const bool _convert,
+bool readStringInternal(std::string_view _xmlString, const bool _convert,
     const ParserConfig &_config, SDFPtr _sdf, Errors &_errors)
 {
+  ElementArenaScope arenaScope(_config);
+  IncludeThreadPoolScope threadPoolScope(_config);
+  if (_config.StreamingParsing())
+  {
+    const StreamedRead read = readDocStream(_xmlString, _sdf,
+        std::string(kSdfStringSource), _convert, _config, _errors);
+    if (read != StreamedRead::NOT_STREAMED)
+      return read == StreamedRead::READ;
+  }
+
   auto xmlDoc = makeSdfDoc();
-  xmlDoc.Parse(_xmlString.c_str());
+  xmlDoc.Parse(_xmlString.data(), _xmlString.size());
   if (xmlDoc.Error())
   {
     _errors.push_back({ErrorCode::STRING_READ,
@@ -955,7 +1225,7 @@ bool readStringInternal(const std::string &_xmlString, const bool _convert,
     {
       URDF2SDF u2g;
       auto doc = makeSdfDoc();
-      u2g.InitModelString(_xmlString, _config, &doc);
+      u2g.InitModelString(std::string(_xmlString), _config, &doc);
 
       if (sdf::readDoc(&doc, _sdf, std::string(kUrdfStringSource), _convert,
                       _config, _errors))
@@ -1003,6 +1273,8 @@ bool readString(const std::string &_xmlString, ElementPtr _sdf, Errors &_errors)
 bool readString(const std::string &_xmlString, const ParserConfig &_config,
     ElementPtr _sdf, Errors &_errors)
 {
+  ElementArenaScope arenaScope(_config);
+  IncludeThreadPoolScope threadPoolScope(_config);
   auto xmlDoc = makeSdfDoc();
   xmlDoc.Parse(_xmlString.c_str());
   if (xmlDoc.Error())
@@ -1026,6 +1298,28 @@ bool readString(const std::string &_xmlString, const ParserConfig &_config,
   }
 }
 
+//////////////////////////////////////////////////
+/// \brief Check that the names in a document that was read have no '::'
+/// delimiter, which is not allowed in SDFormat >= 1.8.
+/// \param[in] _sdf The document.
+/// \param[out] _errors Captures errors found during the check.
+/// \return True if the names are valid.
+static bool checkRootNames(SDFPtr _sdf, Errors &_errors)
+{
+  // delimiter '::' in element names not allowed in SDFormat >= 1.8
+  gz::math::SemanticVersion sdfVersion(_sdf->Root()->OriginalVersion());
+  if (sdfVersion >= gz::math::SemanticVersion(1, 8)
+      && !recursiveSiblingNoDoubleColonInNames(_errors, _sdf->Root()))
+  {
+    _errors.push_back({ErrorCode::RESERVED_NAME,
+        "Delimiter '::' found in attribute names of element <"
+        + _sdf->Root()->GetName() +
+        ">, which is not allowed in SDFormat >= 1.8"});
+    return false;
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 bool readDoc(tinyxml2::XMLDocument *_xmlDoc, SDFPtr _sdf,
     const std::string &_source, bool _convert, const ParserConfig &_config,
@@ -1070,14 +1364,17 @@ bool readDoc(tinyxml2::XMLDocument *_xmlDoc, SDFPtr _sdf,
       _sdf->Root()->SetOriginalVersion(sdfNode->Attribute("version"));
     }
 
-    if (!_sdf->Root()->LineNumber().has_value())
+    if (_config.SourceTracing())
     {
-      _sdf->Root()->SetLineNumber(sdfNode->GetLineNum());
-    }
+      if (!_sdf->Root()->LineNumber().has_value())
+      {
+        _sdf->Root()->SetLineNumber(sdfNode->GetLineNum());
+      }
 
-    if (_sdf->Root()->XmlPath().empty())
-    {
-      _sdf->Root()->SetXmlPath("/sdf");
+      if (_sdf->Root()->XmlPath().empty())
+      {
+        _sdf->Root()->SetXmlPath("/sdf");
+      }
     }
 
     if (_convert
@@ -1106,17 +1403,8 @@ bool readDoc(tinyxml2::XMLDocument *_xmlDoc, SDFPtr _sdf,
       return false;
     }
 
-    // delimiter '::' in element names not allowed in SDFormat >= 1.8
-    gz::math::SemanticVersion sdfVersion(_sdf->Root()->OriginalVersion());
-    if (sdfVersion >= gz::math::SemanticVersion(1, 8)
-        && !recursiveSiblingNoDoubleColonInNames(_errors, _sdf->Root()))
-    {
-      _errors.push_back({ErrorCode::RESERVED_NAME,
-          "Delimiter '::' found in attribute names of element <"
-          + _sdf->Root()->GetName() +
-          ">, which is not allowed in SDFormat >= 1.8"});
+    if (!checkRootNames(_sdf, _errors))
       return false;
-    }
   }
   else
   {
@@ -1159,14 +1447,17 @@ bool readDoc(tinyxml2::XMLDocument *_xmlDoc, ElementPtr _sdf,
       _sdf->SetOriginalVersion(sdfNode->Attribute("version"));
     }
 
-    if (!_sdf->LineNumber().has_value())
+    if (_config.SourceTracing())
     {
-      _sdf->SetLineNumber(sdfNode->GetLineNum());
-    }
+      if (!_sdf->LineNumber().has_value())
+      {
+        _sdf->SetLineNumber(sdfNode->GetLineNum());
+      }
 
-    if (_sdf->XmlPath().empty())
-    {
-      _sdf->SetXmlPath("/sdf");
+      if (_sdf->XmlPath().empty())
+      {
+        _sdf->SetXmlPath("/sdf");
+      }
     }
 
     if (_convert
@@ -1220,6 +1511,37 @@ bool readDoc(tinyxml2::XMLDocument *_xmlDoc, ElementPtr _sdf,
   return true;
 }
 
+//////////////////////////////////////////////////
+/// \brief Check the first <pose> of the first top level <model>, which must
+/// have an empty relative_to frame.
+/// \param[in] _relativeTo Value of the relative_to attribute of the pose,
+/// nullptr if it has none.
+/// \param[in] _lineNumber Line number of the pose.
+/// \param[in] _source Source of the XML document.
+/// \param[out] _errors Captures errors found during the check.
+/// \return True if the pose is valid.
+static bool checkTopLevelPose(const char *_relativeTo, int _lineNumber,
+    const std::string &_source, Errors &_errors)
+{
+  if (!_relativeTo || _relativeTo[0] == '\0')
+    return true;
+
+  std::string errorSourcePath = _source;
+  if (_source == kSdfStringSource || _source == kUrdfStringSource)
+    errorSourcePath = "<" + _source + ">";
+
+  std::stringstream sstream;
+  sstream << "Attribute //pose[@relative_to] of top level model "
+      << "must be left empty, found //pose[@relative_to='"
+      << _relativeTo << "'].\n";
+  _errors.push_back({
+      ErrorCode::ATTRIBUTE_INVALID,
+      sstream.str(),
+      errorSourcePath,
+      _lineNumber});
+  return false;
+}
+
 //////////////////////////////////////////////////
 bool checkXmlFromRoot(tinyxml2::XMLElement *_xmlRoot,
     const std::string &_source, Errors &_errors)
@@ -1230,37 +1552,16 @@ bool checkXmlFromRoot(tinyxml2::XMLElement *_xmlRoot,
   if (!_xmlRoot)
     return true;
 
-  std::string errorSourcePath = _source;
-  if (_source == kSdfStringSource || _source == kUrdfStringSource)
-    errorSourcePath = "<" + _source + ">";
-
   // Top level models must have an empty relative_to frame on the top level
   // pose.
+  if (tinyxml2::XMLElement *topLevelElem =
+      _xmlRoot->FirstChildElement("model"))
   {
-    if (tinyxml2::XMLElement *topLevelElem =
-        _xmlRoot->FirstChildElement("model"))
+    if (tinyxml2::XMLElement *topLevelPose =
+        topLevelElem->FirstChildElement("pose"))
     {
-      if (tinyxml2::XMLElement *topLevelPose =
-          topLevelElem->FirstChildElement("pose"))
-      {
-        if (const char *relativeTo = topLevelPose->Attribute("relative_to"))
-        {
-          const std::string relativeToStr(relativeTo);
-          if (!relativeToStr.empty())
-          {
-            std::stringstream sstream;
-            sstream << "Attribute //pose[@relative_to] of top level model "
-                << "must be left empty, found //pose[@relative_to='"
-                << relativeToStr << "'].\n";
-            _errors.push_back({
-                ErrorCode::ATTRIBUTE_INVALID,
-                sstream.str(),
-                errorSourcePath,
-                topLevelPose->GetLineNum()});
-            return false;
-          }
-        }
-      }
+      return checkTopLevelPose(topLevelPose->Attribute("relative_to"),
+          topLevelPose->GetLineNum(), _source, _errors);
     }
   }
 
@@ -1402,16 +1703,39 @@ std::string getModelFilePath(sdf::Errors &_errors,
   return sdf::filesystem::append(_modelDirPath, modelFileName);
 }
 
+//////////////////////////////////////////////////
+/// \brief Get the line number of an attribute of a tinyxml2 element.
+/// \param[in] _xml The element.
+/// \param[in] _attribute The attribute.
+/// \return Line number of the attribute in the document it was read from.
+static int attributeLineNumber(const tinyxml2::XMLElement *_xml,
+    const tinyxml2::XMLAttribute *_attribute)
+{
+  return XmlSliceDocument::LineNumber(_xml, _attribute);
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the line number of an attribute of a streamed element.
+/// \param[in] _attribute The attribute.
+/// \return Line number of the attribute.
+static int attributeLineNumber(const XmlStreamElement *,
+    const XmlPullReader::XmlAttribute *_attribute)
+{
+  return _attribute->GetLineNum();
+}
+
 //////////////////////////////////////////////////
 /// Helper function that reads all the attributes of an element from TinyXML to
 /// sdf::Element.
-/// \param[in] _xml Pointer to XML element to read the attributes from.
+/// \param[in] _xml Pointer to XML element to read the attributes from, a
+/// tinyxml2::XMLElement or an XmlStreamElement.
 /// \param[in,out] _sdf sdf::Element pointer to parse the attribute data into.
 /// \param[in] _config Custom parser configuration
 /// \param[in] _errorSourcePath Source of the XML document.
 /// \param[out] _errors Captures errors found during parsing.
 /// \return True on success, false on error.
-static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
+template <typename XmlElement>
+static bool readAttributes(XmlElement *_xml, ElementPtr _sdf,
     const ParserConfig &_config, const std::string &_errorSourcePath,
     Errors &_errors)
 {
@@ -1429,7 +1753,7 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
       // //sensor/imu/orientation_reference_frame/custom_rpy/[@parent_frame]
       {"custom_rpy", "parent_frame"}};
 
-  const tinyxml2::XMLAttribute *attribute = _xml->FirstAttribute();
+  const auto *attribute = _xml->FirstAttribute();
 
   unsigned int i = 0;
 
@@ -1446,9 +1770,13 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
       continue;
     }
 
-    // Construct the Xml path of the current attribute
-    const std::string attributeXmlPath = _sdf->XmlPath() + "[@" +
-        attribute->Name() + "=\"" + attribute->Value() + "\"]";
+    // Construct the Xml path of the current attribute only when reporting
+    // an error, since most attributes are read successfully.
+    auto attributeXmlPath = [&_sdf, attribute]()
+    {
+      return _sdf->XmlPath() + "[@" + attribute->Name() + "=\"" +
+          attribute->Value() + "\"]";
+    };
 
     // Find the matching attribute in SDF
     for (i = 0; i < _sdf->GetAttributeCount(); ++i)
@@ -1466,19 +1794,22 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
                 "'" + std::string(attribute->Value()) +
                 "' is reserved; it cannot be used as a value of "
                 "attribute [" + p->GetKey() + "]",
-                _errorSourcePath, attribute->GetLineNum());
-            err.SetXmlPath(attributeXmlPath);
+                _errorSourcePath, attributeLineNumber(_xml, attribute));
+            err.SetXmlPath(attributeXmlPath());
             _errors.push_back(err);
           }
         }
         // Set the value of the SDF attribute
-        if (!p->SetFromString(attribute->Value()))
+        const bool valueSet = _config.LazyValueParsing() ?
+            p->SetFromStringDeferred(attribute->Value()) :
+            p->SetFromString(attribute->Value());
+        if (!valueSet)
         {
           Error err(
               ErrorCode::ATTRIBUTE_INVALID,
               "Unable to read attribute[" + p->GetKey() + "]",
-              _errorSourcePath, attribute->GetLineNum());
-          err.SetXmlPath(attributeXmlPath);
+              _errorSourcePath, attributeLineNumber(_xml, attribute));
+          err.SetXmlPath(attributeXmlPath());
           _errors.push_back(err);
           return false;
         }
@@ -1495,7 +1826,7 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
       Error err(
           ErrorCode::ATTRIBUTE_INCORRECT_TYPE,
           ss.str(), _errorSourcePath, _xml->GetLineNum());
-      err.SetXmlPath(attributeXmlPath);
+      err.SetXmlPath(attributeXmlPath());
       enforceConfigurablePolicyCondition(
           _config.WarningsPolicy(), err, _errors);
     }
@@ -1523,6 +1854,68 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
   return true;
 }
 
+//////////////////////////////////////////////////
+/// \brief Get whether an element is skipped by the parser configuration.
+/// \param[in] _name Name of the element.
+/// \param[in] _config Custom parser configuration
+/// \return True if the element and its children must not be read.
+static bool isSkippedElement(const std::string &_name,
+    const ParserConfig &_config)
+{
+  const std::set<std::string> &skipped = _config.SkippedElements();
+  return !skipped.empty() && skipped.count(_name) > 0;
+}
+
+//////////////////////////////////////////////////
+/// \brief Check that all the required children of an element have been
+/// read, and add the missing ones with their default values. Elements
+/// skipped by the parser configuration are not checked.
+/// \param[in,out] _sdf The element.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document
+/// \param[in] _lineNumber Line number of the XML element.
+/// \param[out] _errors Captures errors about missing elements.
+/// \return False if a required element that has no default is missing.
+static bool readRequiredElements(ElementPtr _sdf, const ParserConfig &_config,
+    const std::string &_source, int _lineNumber, Errors &_errors)
+{
+  for (unsigned int descCounter = 0;
+       descCounter != _sdf->GetElementDescriptionCount(); ++descCounter)
+  {
+    ElementConstPtr elemDesc = _sdf->GetElementDescription(descCounter);
+
+    if ((elemDesc->GetRequired() == "1" || elemDesc->GetRequired() == "+") &&
+        !isSkippedElement(elemDesc->GetName(), _config))
+    {
+      if (!_sdf->HasElement(elemDesc->GetName()))
+      {
+        const std::string elemXmlPath = _sdf->XmlPath() + "/" +
+            elemDesc->GetName();
+        if (_sdf->GetName() == "joint" &&
+            _sdf->Get<std::string>("type") != "ball")
+        {
+          Error missingElementError(
+              ErrorCode::ELEMENT_MISSING,
+              "XML Missing required element[" + elemDesc->GetName() +
+              "], child of element[" + _sdf->GetName() + "]",
+              _source,
+              _lineNumber);
+          missingElementError.SetXmlPath(elemXmlPath);
+          _errors.push_back(missingElementError);
+          return false;
+        }
+        else
+        {
+          // Add default element
+          ElementPtr defaultElement = _sdf->AddElement(elemDesc->GetName());
+          defaultElement->SetExplicitlySetInFile(false);
+        }
+      }
+    }
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 /// Helper function to resolve file name from an //include/uri element.
 /// \param[in] _includeXml Pointer to TinyXML object that corresponds to the
@@ -1533,18 +1926,21 @@ static bool readAttributes(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
 /// \param[in] _errorSourcePath Source of the XML document.
 /// \param[out] _fileName Resolved file name.
 /// \param[out] _errors Captures errors found during parsing.
+/// \param[in] _useCallback True to use the find file callback of _config if
+/// the file is not found otherwise.
 /// \return True if the file name is successfully resolved, false on error.
 static bool resolveFileNameFromUri(tinyxml2::XMLElement *_includeXml,
     const sdf::ParserConfig &_config, const std::string &_includeXmlPath,
     const std::string &_errorSourcePath, std::string &_fileName,
-    Errors &_errors)
+    Errors &_errors, bool _useCallback = true)
 {
   tinyxml2::XMLElement *uriElement = _includeXml->FirstChildElement("uri");
   const std::string uriXmlPath = _includeXmlPath + "/uri";
   if (uriElement)
   {
     const std::string uri = uriElement->GetText();
-    const std::string modelPath = sdf::findFile(uri, true, true, _config);
+    const std::string modelPath =
+        sdf::findFile(uri, true, _useCallback, _config);
 
     // Test the model path
     if (modelPath.empty())
@@ -1614,7 +2010,7 @@ static void validateIncludeElement(tinyxml2::XMLElement *_xml,
   for (unsigned int descCounter = 0;
       descCounter != _sdf->GetElementDescriptionCount(); ++descCounter)
   {
-    ElementPtr elemDesc = _sdf->GetElementDescription(descCounter);
+    ElementConstPtr elemDesc = _sdf->GetElementDescription(descCounter);
     if (elemDesc->GetName() == _xml->Value())
     {
       ElementPtr element = elemDesc->Clone();
@@ -1633,7 +2029,499 @@ static void validateIncludeElement(tinyxml2::XMLElement *_xml,
 }
 
 //////////////////////////////////////////////////
-bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
+/// \brief Read the file of an <include> element into a new document, or
+/// get a copy of it from the include cache of the parser configuration.
+/// \param[in] _filename Resolved path of the included file.
+/// \param[in] _config Custom parser configuration
+/// \param[out] _includeSDF The document read from the file.
+/// \param[out] _errors Captures errors found during parsing.
+/// \return True if the file was read.
+static bool readIncludedFile(const std::string &_filename,
+    const ParserConfig &_config, SDFPtr &_includeSDF, Errors &_errors)
+{
+  // NOTE: sdf::init is an expensive call. For performance reason,
+  // a new sdf pointer is created here by cloning a fresh sdf template
+  // pointer instead of calling init every iteration.
+  // SDFPtr includeSDF(new SDF);
+  // init(includeSDF, _config);
+  // The template is created once, even if several threads get here
+  // at the same time, and only read afterwards.
+  static const SDFPtr includeSDFTemplate = [&_config]()
+  {
+    ElementArenaScope heapScope(nullptr);
+    SDFPtr sdf(new SDF);
+    init(sdf, _config);
+    return sdf;
+  }();
+
+  _includeSDF.reset(new SDF);
+
+  // A cached document is a copy, to which the overrides of the include are
+  // applied by the caller.
+  const std::shared_ptr<IncludeCache> includeCache =
+      ParserConfigCaches::IncludeFileCache(_config);
+  if (!includeCache)
+  {
+    _includeSDF->SetRoot(includeSDFTemplate->Root()->Clone());
+    return readFile(_filename, _config, _includeSDF, _errors);
+  }
+
+  if (includeCache->Get(_filename, _includeSDF, _errors))
+    return true;
+
+  _includeSDF->SetRoot(includeSDFTemplate->Root()->Clone());
+
+  // The warnings printed while reading the file are recorded, so that
+  // later includes of it print them too.
+  const std::size_t firstError = _errors.size();
+  PolicyConditionRecorder recorder;
+  if (!readFile(_filename, _config, _includeSDF, _errors))
+    return false;
+
+  includeCache->Insert(_filename, _includeSDF,
+      sdf::Errors(_errors.begin() + firstError, _errors.end()),
+      recorder.Conditions());
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief An <include> element whose file was read ahead of time.
+struct PrefetchedInclude
+{
+  /// \brief True if the URI of the include was resolved ahead of time.
+  /// Otherwise the include is processed as when reading serially.
+  bool prefetched = false;
+
+  /// \brief Errors found while resolving the URI of the include.
+  Errors resolveErrors;
+
+  /// \brief True if the URI of the include was resolved.
+  bool resolved = false;
+
+  /// \brief Resolved path of the included file.
+  std::string filename;
+
+  /// \brief True if the file was read into sdf.
+  bool read = false;
+
+  /// \brief The document read from the file, if it is an SDFormat file.
+  SDFPtr sdf;
+
+  /// \brief Errors found while reading the file.
+  Errors readErrors;
+
+  /// \brief Exception thrown while reading the file, rethrown when the
+  /// include is processed.
+  std::exception_ptr exception;
+};
+
+//////////////////////////////////////////////////
+/// \brief The <include> children of an element, whose files are read by
+/// the tasks of an IncludeThreadPool.
+struct IncludeBatch
+{
+  /// \brief Destructor. Waits for the tasks, which use the batch.
+  ~IncludeBatch()
+  {
+    this->WaitForReads();
+  }
+
+  /// \brief Wait until all the submitted files are read.
+  void WaitForReads()
+  {
+    if (this->pool)
+      this->pool->Wait([this]()
+      {
+        return this->pending == 0;
+      });
+  }
+
+  /// \brief Record that an include failed to be read.
+  /// \param[in] _index Index of the include.
+  void Fail(std::size_t _index)
+  {
+    std::size_t first = this->firstFailure;
+    while (_index < first &&
+           !this->firstFailure.compare_exchange_weak(first, _index))
+    {
+    }
+  }
+
+  /// \brief Check if the result of an include is discarded, because an
+  /// include before it in the document failed to be read.
+  /// \param[in] _index Index of the include.
+  /// \return True if an earlier include of this batch, or of the batches
+  /// of the files that include this one, failed.
+  bool Cancelled(std::size_t _index) const
+  {
+    return this->firstFailure < _index ||
+        (this->parent && this->parent->Cancelled(this->parentIndex));
+  }
+
+  /// \brief Pool that reads the files.
+  IncludeThreadPool *pool = nullptr;
+
+  /// \brief The includes, in document order.
+  std::vector<PrefetchedInclude> includes;
+
+  /// \brief Number of submitted files that are not read yet.
+  std::atomic<std::size_t> pending{0};
+
+  /// \brief Index of the first include that failed to be read.
+  std::atomic<std::size_t> firstFailure{
+      std::numeric_limits<std::size_t>::max()};
+
+  /// \brief Batch of the task that reads the file of this batch, if any.
+  const IncludeBatch *parent = nullptr;
+
+  /// \brief Index of the include of that task in the parent batch.
+  std::size_t parentIndex = 0;
+};
+
+//////////////////////////////////////////////////
+/// \brief Batch and index of the include read by the task running on the
+/// calling thread, if any.
+static thread_local const IncludeBatch *tlsIncludeBatch = nullptr;
+static thread_local std::size_t tlsIncludeIndex = 0;
+
+//////////////////////////////////////////////////
+/// \brief Check if the file read by the calling thread will be discarded,
+/// because an include before it in the document failed to be read. Reading
+/// it can then stop, before more find file callbacks are called.
+/// \return True if the read is cancelled.
+static bool includeReadCancelled()
+{
+  return tlsIncludeBatch && tlsIncludeBatch->Cancelled(tlsIncludeIndex);
+}
+
+//////////////////////////////////////////////////
+/// \brief Read the files of the <include> children of an element in
+/// parallel, with the IncludeThreadPool of the load. The results are
+/// consumed by readXml in document order, so its output and errors are the
+/// same as when the files are read one at a time.
+///
+/// URIs are resolved on the calling thread, in document order. The find
+/// file callback is only used for an include once the files of the
+/// previous includes are read, and not at all if one of them failed, as
+/// when reading serially.
+/// \param[in] _xml The XML element whose children are read.
+/// \param[in] _sdf The element that corresponds to _xml.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document
+/// \return The includes, in document order, or an empty vector if the
+/// files should be read serially.
+static std::vector<PrefetchedInclude> prefetchIncludes(
+    tinyxml2::XMLElement *_xml, ElementPtr _sdf, const ParserConfig &_config,
+    const std::string &_source)
+{
+  IncludeBatch batch;
+  batch.pool = IncludeThreadPool::Active();
+  if (!batch.pool)
+    return {};
+
+  std::vector<tinyxml2::XMLElement *> includeXmls;
+  for (auto *elemXml = _xml->FirstChildElement("include"); elemXml;
+       elemXml = elemXml->NextSiblingElement("include"))
+  {
+    includeXmls.push_back(elemXml);
+  }
+
+  // A single file is read by the calling thread anyway
+  if (includeXmls.size() < 2)
+    return {};
+
+  // The tasks keep references to the includes, so they are all created
+  // before the first task is submitted.
+  batch.includes.resize(includeXmls.size());
+  batch.parent = tlsIncludeBatch;
+  batch.parentIndex = tlsIncludeIndex;
+
+  // Warnings printed by the tasks are recorded like those of the calling
+  // thread, for the include cache. The included documents are allocated
+  // from the arena of the calling thread, if any, so that the document
+  // keeps a single arena.
+  PolicyConditionRecorder *callerRecorder = PolicyConditionRecorder::Active();
+  std::shared_ptr<ElementArena> callerArena = ElementArena::Active();
+
+  for (std::size_t i = 0; i < includeXmls.size(); ++i)
+  {
+    if (batch.Cancelled(i) || includeReadCancelled())
+      break;
+
+    const std::string includeXmlPath = _sdf->XmlPath() + "/include[" +
+        std::to_string(i) + "]";
+
+    PrefetchedInclude &include = batch.includes[i];
+    include.resolved = resolveFileNameFromUri(includeXmls[i], _config,
+        includeXmlPath, _source, include.filename, include.resolveErrors,
+        false);
+    if (!include.resolved)
+    {
+      // The find file callback, and errors, are only needed once the
+      // previous includes are read successfully.
+      include.resolveErrors.clear();
+      batch.WaitForReads();
+      if (batch.Cancelled(i) || includeReadCancelled())
+        break;
+
+      include.resolved = resolveFileNameFromUri(includeXmls[i], _config,
+          includeXmlPath, _source, include.filename, include.resolveErrors);
+    }
+    include.prefetched = true;
+
+    if (!include.resolved || !(sdf::isSdfFile(include.filename) ||
+        _config.CustomModelParsers().empty()))
+    {
+      continue;
+    }
+
+    ++batch.pending;
+    batch.pool->Submit(
+        [&batch, &include, &_config, i, callerRecorder, callerArena]()
+    {
+      PolicyConditionRecorder recorder(callerRecorder);
+      ElementArenaScope arenaScope(callerArena);
+      const IncludeBatch *previousBatch = tlsIncludeBatch;
+      const std::size_t previousIndex = tlsIncludeIndex;
+      tlsIncludeBatch = &batch;
+      tlsIncludeIndex = i;
+
+      if (!batch.Cancelled(i))
+      {
+        try
+        {
+          include.read = readIncludedFile(
+              include.filename, _config, include.sdf, include.readErrors);
+        }
+        catch (...)
+        {
+          include.exception = std::current_exception();
+        }
+        if (!include.read || include.exception)
+          batch.Fail(i);
+      }
+
+      tlsIncludeBatch = previousBatch;
+      tlsIncludeIndex = previousIndex;
+      --batch.pending;
+    });
+  }
+
+  batch.WaitForReads();
+  return std::move(batch.includes);
+}
+
+//////////////////////////////////////////////////
+/// \brief The includes of a streamed element are not known before its
+/// children are read, so their files are read serially.
+/// \return An empty vector.
+static std::vector<PrefetchedInclude> prefetchIncludes(
+    XmlStreamElement *, ElementPtr, const ParserConfig &, const std::string &)
+{
+  return {};
+}
+
+//////////////////////////////////////////////////
+/// \brief Get a tinyxml2 element.
+/// \param[in] _xml The element.
+/// \return The element.
+static tinyxml2::XMLElement *xmlElement(tinyxml2::XMLElement *_xml,
+    std::unique_ptr<XmlSliceDocument> &)
+{
+  return _xml;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get a tinyxml2 element for a streamed element, parsed from its
+/// source. This reads the rest of the streamed element.
+/// \param[in] _xml The streamed element.
+/// \param[out] _doc Document of the tinyxml2 element.
+/// \return The tinyxml2 element.
+static tinyxml2::XMLElement *xmlElement(XmlStreamElement *_xml,
+    std::unique_ptr<XmlSliceDocument> &_doc)
+{
+  const int lineNumber = _xml->GetLineNum();
+  _doc = std::make_unique<XmlSliceDocument>();
+  if (!_doc->ParseElement(_xml->ReadSource(), lineNumber))
+    throw XmlStreamError(_doc->ErrorStr());
+  return _doc->RootElement();
+}
+
+//////////////////////////////////////////////////
+/// \brief Copy the children of a tinyxml2 element that are not defined in
+/// SDF, once the others are read.
+/// \param[in,out] _sdf The element.
+/// \param[in] _xml The tinyxml2 element.
+static void copyUnknownChildren(ElementPtr _sdf, tinyxml2::XMLElement *_xml,
+    const std::vector<std::unique_ptr<XmlSliceDocument>> &)
+{
+  copyChildren(_sdf, _xml, true);
+}
+
+//////////////////////////////////////////////////
+/// \brief Copy the children of a streamed element that are not defined in
+/// SDF, once the others are read.
+/// \param[in,out] _sdf The element.
+/// \param[in] _unknownDocs Documents parsed from the source of the
+/// children, in document order.
+static void copyUnknownChildren(ElementPtr _sdf, XmlStreamElement *,
+    const std::vector<std::unique_ptr<XmlSliceDocument>> &_unknownDocs)
+{
+  for (const auto &doc : _unknownDocs)
+    copyChildren(_sdf, doc.get(), true);
+}
+
+//////////////////////////////////////////////////
+/// \brief The top level pose of a tinyxml2 document is checked by
+/// checkXmlFromRoot() before the document is read.
+static void checkStreamedChild(tinyxml2::XMLElement *, ElementPtr,
+    const std::string &, Errors &)
+{
+}
+
+//////////////////////////////////////////////////
+/// \brief Check a child of a streamed element as checkXmlFromRoot() checks
+/// a tinyxml2 document. The first <pose> of the first top level <model> is
+/// checked once it is read.
+/// \param[in] _xml The child.
+/// \param[in] _sdf The element.
+/// \param[in] _source Source of the XML document
+/// \param[out] _errors Captures errors found during the check.
+/// \throws TopLevelCheckError if the check fails.
+static void checkStreamedChild(XmlStreamElement *_xml, ElementPtr _sdf,
+    const std::string &_source, Errors &_errors)
+{
+  if (std::strcmp(_xml->Value(), "pose") != 0 || _sdf->GetName() != "model")
+    return;
+
+  ElementPtr root = _sdf->GetParent();
+  if (!root || root->GetParent() || root->HasElement("model") ||
+      _sdf->HasElement("pose"))
+  {
+    return;
+  }
+
+  if (!checkTopLevelPose(_xml->Attribute("relative_to"), _xml->GetLineNum(),
+      _source, _errors))
+  {
+    throw TopLevelCheckError();
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Result of reading a child of an element.
+enum class ChildXmlRead
+{
+  /// \brief The child was read, or skipped by the parser configuration.
+  READ,
+
+  /// \brief The child is not defined in SDF, and is copied once the other
+  /// children are read.
+  UNKNOWN,
+
+  /// \brief The child could not be read.
+  FAILED
+};
+
+template <typename XmlElement>
+static bool readXmlImpl(XmlElement *_xml, ElementPtr _sdf,
+    const ParserConfig &_config, const std::string &_source, Errors &_errors);
+
+//////////////////////////////////////////////////
+/// \brief Read a child element, other than an <include> of an SDFormat
+/// file, and insert it in its parent.
+/// \param[in] _elemXml The child, a tinyxml2::XMLElement or an
+/// XmlStreamElement.
+/// \param[in] _parentName Name of the parent XML element.
+/// \param[in,out] _sdf The parent element.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document
+/// \param[out] _errors Captures errors found during parsing.
+/// \return Whether the child was read.
+template <typename XmlElement>
+static ChildXmlRead readChildXml(XmlElement *_elemXml,
+    const char *_parentName, ElementPtr _sdf, const ParserConfig &_config,
+    const std::string &_source, Errors &_errors)
+{
+  // Find the matching element in SDF
+  ElementConstPtr elemDesc = _sdf->GetElementDescription(_elemXml->Value());
+  if (!elemDesc)
+  {
+    if (std::strchr(_elemXml->Value(), ':') == nullptr)
+    {
+      std::string elemXmlPath = _sdf->XmlPath() + "/" + _elemXml->Value();
+      const char *name = _elemXml->Attribute("name");
+      if (name)
+        elemXmlPath += "[@name=\"" + std::string(name) + "\"]";
+
+      std::stringstream ss;
+      ss << "XML Element[" << _elemXml->Value()
+         << "], child of element[" << _parentName
+         << "], not defined in SDF. Copying[" << _elemXml->Value() << "] "
+         << "as children of [" << _parentName << "].\n";
+
+      Error err(
+          ErrorCode::ELEMENT_INCORRECT_TYPE,
+          ss.str(),
+          _source,
+          _elemXml->GetLineNum());
+      err.SetXmlPath(elemXmlPath);
+      enforceConfigurablePolicyCondition(
+          _config.UnrecognizedElementsPolicy(), err, _errors);
+    }
+    return ChildXmlRead::UNKNOWN;
+  }
+
+  if (isSkippedElement(elemDesc->GetName(), _config))
+    return ChildXmlRead::READ;
+
+  // The Xml path is only built when it is recorded in the element.
+  // Otherwise errors about this element are reported without it.
+  std::string elemXmlPath;
+  if (_config.SourceTracing())
+  {
+    elemXmlPath = _sdf->XmlPath() + "/" + _elemXml->Value();
+    const char *name = _elemXml->Attribute("name");
+    if (name)
+      elemXmlPath += "[@name=\"" + std::string(name) + "\"]";
+  }
+
+  ElementPtr element = elemDesc->Clone();
+  element->SetParent(_sdf);
+  if (_config.SourceTracing())
+  {
+    element->SetLineNumber(_elemXml->GetLineNum());
+    element->SetXmlPath(elemXmlPath);
+  }
+  if (!readXmlImpl(_elemXml, element, _config, _source, _errors))
+  {
+    Error err(
+        ErrorCode::ELEMENT_INVALID,
+        std::string("Error reading element <") +
+        _elemXml->Value() + ">",
+        _source,
+        _elemXml->GetLineNum());
+    err.SetXmlPath(elemXmlPath);
+    _errors.push_back(err);
+    return ChildXmlRead::FAILED;
+  }
+
+  _sdf->InsertElement(element);
+  return ChildXmlRead::READ;
+}
+
+//////////////////////////////////////////////////
+/// \brief Implementation of readXml(), which also reads the elements of a
+/// streamed document.
+/// \param[in] _xml Pointer to the XML element, a tinyxml2::XMLElement or an
+/// XmlStreamElement.
+/// \param[in,out] _sdf SDF pointer to parse data into.
+/// \param[in] _config Custom parser configuration
+/// \param[in] _source Source of the XML document
+/// \param[out] _errors Captures errors found during parsing.
+/// \return True on success, false on error.
+template <typename XmlElement>
+static bool readXmlImpl(XmlElement *_xml, ElementPtr _sdf,
     const ParserConfig &_config, const std::string &_source, Errors &_errors)
 {
   // Check if the element pointer is deprecated.
@@ -1691,7 +2579,10 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
 
   if (_xml->GetText() != nullptr && _sdf->GetValue())
   {
-    if (!_sdf->GetValue()->SetFromString(_xml->GetText()))
+    const bool valueSet = _config.LazyValueParsing() ?
+        _sdf->GetValue()->SetFromStringDeferred(_xml->GetText()) :
+        _sdf->GetValue()->SetFromString(_xml->GetText());
+    if (!valueSet)
       return false;
   }
   else if (_sdf->GetValue())
@@ -1704,7 +2595,8 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
 
   if (_sdf->GetCopyChildren())
   {
-    copyChildren(_sdf, _xml, false);
+    std::unique_ptr<XmlSliceDocument> doc;
+    copyChildren(_sdf, xmlElement(_xml, doc), false);
   }
   else
   {
@@ -1713,45 +2605,82 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
     // Keep count of the include indices
     int includeElemIndex = -1;
 
+    // Files of the includes read in parallel, if enabled
+    std::vector<PrefetchedInclude> prefetched =
+        prefetchIncludes(_xml, _sdf, _config, _source);
+
+    // Unknown children of a streamed element, which are copied once the
+    // others are read, as those of a tinyxml2 element.
+    std::vector<std::unique_ptr<XmlSliceDocument>> unknownDocs;
+
     // Iterate over all the child elements
-    tinyxml2::XMLElement *elemXml = nullptr;
-    for (elemXml = _xml->FirstChildElement(); elemXml;
+    for (auto *elemXml = _xml->FirstChildElement(); elemXml;
          elemXml = elemXml->NextSiblingElement())
     {
+      checkStreamedChild(elemXml, _sdf, _source, _errors);
+
       if (std::string("include") == elemXml->Value())
       {
-        validateIncludeElement(elemXml, _sdf, _config, _source, _errors);
+        // The include is read from a tinyxml2 element, which is parsed from
+        // the source of a streamed element.
+        std::unique_ptr<XmlSliceDocument> includeDoc;
+        tinyxml2::XMLElement *includeXml = xmlElement(elemXml, includeDoc);
+
+        validateIncludeElement(includeXml, _sdf, _config, _source, _errors);
 
-        tinyxml2::XMLElement *uriElement = elemXml->FirstChildElement("uri");
+        tinyxml2::XMLElement *uriElement = includeXml->FirstChildElement("uri");
 
         const std::string includeXmlPath = _sdf->XmlPath() + "/include[" +
             std::to_string(++includeElemIndex) + "]";
         const std::string uriXmlPath = includeXmlPath + "/uri";
 
-        if (!resolveFileNameFromUri(elemXml, _config, includeXmlPath,
-                _source, filename, _errors))
+        PrefetchedInclude *prefetchedInclude = nullptr;
+        if (!prefetched.empty() && prefetched[includeElemIndex].prefetched)
+          prefetchedInclude = &prefetched[includeElemIndex];
+
+        if (prefetchedInclude)
+        {
+          _errors.insert(_errors.end(),
+              prefetchedInclude->resolveErrors.begin(),
+              prefetchedInclude->resolveErrors.end());
+          if (!prefetchedInclude->resolved)
+            continue;
+          filename = prefetchedInclude->filename;
+        }
+        else if (includeReadCancelled())
+        {
+          // This file is read ahead of time, and its result is discarded
+          return false;
+        }
+        else if (!resolveFileNameFromUri(includeXml, _config, includeXmlPath,
+                     _source, filename, _errors))
+        {
           continue;
+        }
 
         // If the file is not an SDFormat file, it is assumed that it will
         // handled by a custom parser, so fall through and add the include
         // element into _sdf.
         if (sdf::isSdfFile(filename) || _config.CustomModelParsers().empty())
         {
-          // NOTE: sdf::init is an expensive call. For performance reason,
-          // a new sdf pointer is created here by cloning a fresh sdf template
-          // pointer instead of calling init every iteration.
-          // SDFPtr includeSDF(new SDF);
-          // init(includeSDF, _config);
-          static SDFPtr includeSDFTemplate;
-          if (!includeSDFTemplate)
+          SDFPtr includeSDF;
+          bool read = false;
+          if (prefetchedInclude)
           {
-            includeSDFTemplate.reset(new SDF);
-            init(includeSDFTemplate, _config);
+            if (prefetchedInclude->exception)
+              std::rethrow_exception(prefetchedInclude->exception);
+            _errors.insert(_errors.end(),
+                prefetchedInclude->readErrors.begin(),
+                prefetchedInclude->readErrors.end());
+            includeSDF = std::move(prefetchedInclude->sdf);
+            read = prefetchedInclude->read;
+          }
+          else
+          {
+            read = readIncludedFile(filename, _config, includeSDF, _errors);
           }
-          SDFPtr includeSDF(new SDF);
-          includeSDF->SetRoot(includeSDFTemplate->Root()->Clone());
 
-          if (!readFile(filename, _config, includeSDF, _errors))
+          if (!read)
           {
             Error err(
                 ErrorCode::FILE_READ,
@@ -1821,17 +2750,20 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
           bool isModel = topLevelElementType == "model";
           bool isActor = topLevelElementType == "actor";
 
-          if (elemXml->FirstChildElement("name"))
+          if (includeXml->FirstChildElement("name"))
           {
             const std::string overrideName =
-                elemXml->FirstChildElement("name")->GetText();
+                includeXml->FirstChildElement("name")->GetText();
             topLevelElem->GetAttribute("name")->SetFromString(overrideName);
-            topLevelElem->SetXmlPath("/sdf/" + topLevelElementType +
-                "[@name=\"" + overrideName + "\"]");
+            if (_config.SourceTracing())
+            {
+              topLevelElem->SetXmlPath("/sdf/" + topLevelElementType +
+                  "[@name=\"" + overrideName + "\"]");
+            }
           }
 
           tinyxml2::XMLElement *poseElemXml =
-              elemXml->FirstChildElement("pose");
+              includeXml->FirstChildElement("pose");
           if (poseElemXml)
           {
             sdf::ElementPtr poseElem = topLevelElem->GetElement("pose");
@@ -1865,26 +2797,26 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
             }
           }
 
-          if (isModel && elemXml->FirstChildElement("static"))
+          if (isModel && includeXml->FirstChildElement("static"))
           {
             topLevelElem->GetElement("static")->GetValue()->SetFromString(
-                elemXml->FirstChildElement("static")->GetText());
+                includeXml->FirstChildElement("static")->GetText());
           }
 
           auto *placementFrameElem =
-              elemXml->FirstChildElement("placement_frame");
+              includeXml->FirstChildElement("placement_frame");
           if (isModel && placementFrameElem)
           {
             const std::string placementFrameXmlPath =
                 includeXmlPath + "/placement_frame";
-            if (nullptr == elemXml->FirstChildElement("pose"))
+            if (nullptr == includeXml->FirstChildElement("pose"))
             {
               Error err(
                   ErrorCode::MODEL_PLACEMENT_FRAME_INVALID,
                   "<pose> is required when specifying the placement_frame "
                   "element",
                   _source,
-                  elemXml->GetLineNum());
+                  includeXml->GetLineNum());
               err.SetXmlPath(placementFrameXmlPath);
               _errors.push_back(err);
               return false;
@@ -1913,7 +2845,7 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
             // Using indices for plugins as duplicated plugin names are
             // allowed.
             int pluginIndex = -1;
-            for (auto *childElemXml = elemXml->FirstChildElement();
+            for (auto *childElemXml = includeXml->FirstChildElement();
                  childElemXml;
                  childElemXml = childElemXml->NextSiblingElement())
             {
@@ -1924,8 +2856,11 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
 
                 sdf::ElementPtr pluginElem;
                 pluginElem = topLevelElem->AddElement("plugin");
-                pluginElem->SetLineNumber(childElemXml->GetLineNum());
-                pluginElem->SetXmlPath(pluginXmlPath);
+                if (_config.SourceTracing())
+                {
+                  pluginElem->SetLineNumber(childElemXml->GetLineNum());
+                  pluginElem->SetXmlPath(pluginXmlPath);
+                }
 
                 if (!readXml(
                     childElemXml, pluginElem, _config, _source, _errors))
@@ -1945,12 +2880,12 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
 
           // TODO(jenn) prototyping parameter passing
           // ref: sdformat.org > Documentation > Proposal for parameter passing
-          if (elemXml->FirstChildElement("experimental:params"))
+          if (includeXml->FirstChildElement("experimental:params"))
           {
             ParamPassing::updateParams(
                 _config,
                 _source,
-                elemXml->FirstChildElement("experimental:params"),
+                includeXml->FirstChildElement("experimental:params"),
                 includeSDF->Root(),
                 _errors);
           }
@@ -1962,123 +2897,160 @@ bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
             // Store the contents of the <include> tag as the includeElement of
             // the entity that was loaded from the included URI.
             auto includeInfo = includeDesc->Clone();
-            copyChildren(includeInfo, elemXml, false);
+            copyChildren(includeInfo, includeXml, false);
             includeSDFFirstElem->SetIncludeElement(includeInfo);
           }
-          bool toMerge = elemXml->BoolAttribute("merge", false);
+          bool toMerge = includeXml->BoolAttribute("merge", false);
           SourceLocation sourceLoc{includeXmlPath, _source,
-                                   elemXml->GetLineNum()};
+                                   includeXml->GetLineNum()};
 
           insertIncludedElement(includeSDF, sourceLoc, toMerge, _sdf, _config,
                                 _errors);
           continue;
         }
+
+        const ChildXmlRead read = readChildXml(
+            includeXml, _xml->Value(), _sdf, _config, _source, _errors);
+        if (read == ChildXmlRead::FAILED)
+          return false;
+        if (read == ChildXmlRead::UNKNOWN && includeDoc)
+          unknownDocs.push_back(std::move(includeDoc));
+        continue;
       }
 
-      // Find the matching element in SDF
-      unsigned int descCounter = 0;
-      for (descCounter = 0;
-           descCounter != _sdf->GetElementDescriptionCount(); ++descCounter)
+      const ChildXmlRead read = readChildXml(
+          elemXml, _xml->Value(), _sdf, _config, _source, _errors);
+      if (read == ChildXmlRead::FAILED)
+        return false;
+      if (read == ChildXmlRead::UNKNOWN)
       {
-        ElementPtr elemDesc = _sdf->GetElementDescription(descCounter);
-        if (elemDesc->GetName() == elemXml->Value())
-        {
-          std::string elemXmlPath = _sdf->XmlPath() + "/" + elemXml->Value();
-          const char *name = elemXml->Attribute("name");
-          if (name)
-            elemXmlPath += "[@name=\"" + std::string(name) + "\"]";
-
-          ElementPtr element = elemDesc->Clone();
-          element->SetParent(_sdf);
-          element->SetLineNumber(elemXml->GetLineNum());
-          element->SetXmlPath(elemXmlPath);
-          if (readXml(elemXml, element, _config, _source, _errors))
-          {
-            _sdf->InsertElement(element);
-          }
-          else
-          {
-            Error err(
-                ErrorCode::ELEMENT_INVALID,
-                std::string("Error reading element <") +
-                elemXml->Value() + ">",
-                _source,
-                elemXml->GetLineNum());
-            err.SetXmlPath(elemXmlPath);
-            _errors.push_back(err);
-            return false;
-          }
-          break;
-        }
+        std::unique_ptr<XmlSliceDocument> unknownDoc;
+        xmlElement(elemXml, unknownDoc);
+        if (unknownDoc)
+          unknownDocs.push_back(std::move(unknownDoc));
       }
+    }
 
-      if (descCounter == _sdf->GetElementDescriptionCount()
-            && std::strchr(elemXml->Value(), ':') == nullptr)
-      {
-        std::string elemXmlPath = _sdf->XmlPath() + "/" + elemXml->Value();
-        const char *name = elemXml->Attribute("name");
-        if (name)
-          elemXmlPath += "[@name=\"" + std::string(name) + "\"]";
+    // Copy unknown elements outside the loop so it only happens one time
+    copyUnknownChildren(_sdf, _xml, unknownDocs);
 
-        std::stringstream ss;
-        ss << "XML Element[" << elemXml->Value()
-           << "], child of element[" << _xml->Value()
-           << "], not defined in SDF. Copying[" << elemXml->Value() << "] "
-           << "as children of [" << _xml->Value() << "].\n";
+    // Check that all required elements have been set
+    if (!readRequiredElements(_sdf, _config, _source, _xml->GetLineNum(),
+                              _errors))
+      return false;
+  }
 
-        Error err(
-            ErrorCode::ELEMENT_INCORRECT_TYPE,
-            ss.str(),
-            _source,
-            elemXml->GetLineNum());
-        err.SetXmlPath(elemXmlPath);
-        enforceConfigurablePolicyCondition(
-            _config.UnrecognizedElementsPolicy(), err, _errors);
+  return true;
+}
 
-        continue;
-      }
+//////////////////////////////////////////////////
+bool readXml(tinyxml2::XMLElement *_xml, ElementPtr _sdf,
+    const ParserConfig &_config, const std::string &_source, Errors &_errors)
+{
+  return readXmlImpl(_xml, _sdf, _config, _source, _errors);
+}
+
+//////////////////////////////////////////////////
+static StreamedRead readDocStream(std::string_view _xml, SDFPtr _sdf,
+    const std::string &_source, const bool _convert,
+    const ParserConfig &_config, Errors &_errors)
+{
+  if (nullptr == _sdf || nullptr == _sdf->Root() ||
+      _sdf->Root()->GetName() != "sdf")
+  {
+    return StreamedRead::NOT_STREAMED;
+  }
+
+  // Read up to the start tag of the root element
+  XmlPullReader reader(_xml);
+  XmlPullReader::Event event = reader.Next();
+  while (event == XmlPullReader::Event::OTHER)
+    event = reader.Next();
+
+  if (event != XmlPullReader::Event::START_ELEMENT ||
+      std::strcmp(reader.Value(), "sdf") != 0 ||
+      !reader.Attribute("version") ||
+      (_convert && reader.Attribute("version") != SDF::Version()))
+  {
+    return StreamedRead::NOT_STREAMED;
+  }
+
+  // This mirrors readDoc()
+  if (_source != std::string(kSdfStringSource))
+  {
+    _sdf->SetFilePath(_source);
+  }
+
+  const std::string version = reader.Attribute("version");
+  if (_sdf->OriginalVersion().empty())
+  {
+    _sdf->SetOriginalVersion(version);
+  }
+
+  if (_sdf->Root()->OriginalVersion().empty())
+  {
+    _sdf->Root()->SetOriginalVersion(version);
+  }
+
+  if (_config.SourceTracing())
+  {
+    if (!_sdf->Root()->LineNumber().has_value())
+    {
+      _sdf->Root()->SetLineNumber(reader.GetLineNum());
     }
 
-    // Copy unknown elements outside the loop so it only happens one time
-    copyChildren(_sdf, _xml, true);
+    if (_sdf->Root()->XmlPath().empty())
+    {
+      _sdf->Root()->SetXmlPath("/sdf");
+    }
+  }
 
-    // Check that all required elements have been set
-    for (unsigned int descCounter = 0;
-         descCounter != _sdf->GetElementDescriptionCount(); ++descCounter)
+  try
+  {
+    XmlStreamElement sdfXml(reader);
+    if (!readXmlImpl(&sdfXml, _sdf->Root(), _config, _source, _errors))
     {
-      ElementPtr elemDesc = _sdf->GetElementDescription(descCounter);
+      _errors.push_back({ErrorCode::ELEMENT_INVALID,
+          "Error reading element <" + _sdf->Root()->GetName() + ">"});
+      return StreamedRead::FAILED;
+    }
 
-      if (elemDesc->GetRequired() == "1" || elemDesc->GetRequired() == "+")
-      {
-        if (!_sdf->HasElement(elemDesc->GetName()))
-        {
-          const std::string elemXmlPath = _sdf->XmlPath() + "/" +
-              elemDesc->GetName();
-          if (_sdf->GetName() == "joint" &&
-              _sdf->Get<std::string>("type") != "ball")
-          {
-            Error missingElementError(
-                ErrorCode::ELEMENT_MISSING,
-                "XML Missing required element[" + elemDesc->GetName() +
-                "], child of element[" + _sdf->GetName() + "]",
-                _source,
-                _xml->GetLineNum());
-            missingElementError.SetXmlPath(elemXmlPath);
-            _errors.push_back(missingElementError);
-            return false;
-          }
-          else
-          {
-            // Add default element
-            ElementPtr defaultElement = _sdf->AddElement(elemDesc->GetName());
-            defaultElement->SetExplicitlySetInFile(false);
-          }
-        }
-      }
+    // The rest of the document must be valid too
+    do
+    {
+      event = reader.Next();
+    }
+    while (event == XmlPullReader::Event::OTHER);
+
+    if (event != XmlPullReader::Event::END_DOCUMENT)
+      throw XmlStreamError(reader.ErrorMessage());
+  }
+  catch (const XmlStreamError &e)
+  {
+    // The elements read before the error are kept, as when readXml() fails
+    if (_source == kSdfStringSource)
+    {
+      _errors.push_back({ErrorCode::STRING_READ,
+                        "Error parsing XML from string: " +
+                        std::string(e.what())});
+    }
+    else
+    {
+      _errors.push_back({ErrorCode::FILE_READ, "Error parsing XML in file [" +
+                        _source + "]: " + std::string(e.what())});
     }
+    return StreamedRead::FAILED;
+  }
+  catch (const TopLevelCheckError &)
+  {
+    _errors.push_back({ErrorCode::ELEMENT_INVALID,
+        "Errors were found when checking the XML of element<"
+        + _sdf->Root()->GetName() + ">."});
+    return StreamedRead::FAILED;
   }
 
-  return true;
+  return checkRootNames(_sdf, _errors) ? StreamedRead::READ :
+      StreamedRead::FAILED;
 }
 
 /////////////////////////////////////////////////
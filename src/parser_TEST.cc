@@ -26,6 +26,7 @@
 
 #include <gz/utils/Environment.hh>
 
+#include "EmbeddedSdf.hh"
 #include "test_config.hh"
 #include "test_utils.hh"
 
@@ -123,6 +124,124 @@ TEST(Parser, ReusedSDFVersion)
   EXPECT_EQ("1.6", sdf->Root()->OriginalVersion());
 }
 
+/////////////////////////////////////////////////
+/// Checks that elements initialized from the spec cache are independent
+TEST(Parser, InitReturnsIndependentSpecs)
+{
+  sdf::SDFPtr sdf1 = InitSDF();
+  sdf::SDFPtr sdf2 = InitSDF();
+  ASSERT_NE(nullptr, sdf1->Root());
+  ASSERT_NE(nullptr, sdf2->Root());
+  EXPECT_NE(sdf1->Root(), sdf2->Root());
+
+  EXPECT_EQ("sdf", sdf2->Root()->GetName());
+  EXPECT_EQ(sdf1->Root()->GetElementDescriptionCount(),
+            sdf2->Root()->GetElementDescriptionCount());
+  EXPECT_EQ(sdf1->Root()->GetAttributeCount(),
+            sdf2->Root()->GetAttributeCount());
+
+  // Element descriptions are immutable and shared between both roots
+  sdf::ElementConstPtr world1 =
+      sdf1->Root()->GetElementDescription("world");
+  sdf::ElementConstPtr world2 =
+      sdf2->Root()->GetElementDescription("world");
+  ASSERT_NE(nullptr, world1);
+  EXPECT_EQ(world1, world2);
+
+  // Values are owned by each element
+  sdf1->Root()->GetAttribute("version")->Set<std::string>("modified");
+  EXPECT_NE("modified",
+            sdf2->Root()->GetAttribute("version")->GetAsString());
+
+  sdf::ElementPtr worldElem1 = sdf1->Root()->AddElement("world");
+  sdf::ElementPtr worldElem2 = sdf2->Root()->AddElement("world");
+  ASSERT_NE(nullptr, worldElem1);
+  ASSERT_NE(nullptr, worldElem2);
+  worldElem1->GetAttribute("name")->Set<std::string>("modified");
+  EXPECT_NE("modified", worldElem2->GetAttribute("name")->GetAsString());
+  EXPECT_NE("modified", world1->GetAttribute("name")->GetAsString());
+
+  sdf::SDFPtr sdf3 = InitSDF();
+  EXPECT_NE("modified",
+            sdf3->Root()->GetAttribute("version")->GetAsString());
+  EXPECT_FALSE(sdf3->Root()->HasElement("world"));
+
+  // initFile on an embedded spec file is served from the same cache
+  sdf::ElementPtr model(new sdf::Element);
+  EXPECT_TRUE(sdf::initFile("model.sdf", model));
+  EXPECT_EQ("model", model->GetName());
+  EXPECT_TRUE(model->HasElementDescription("link"));
+}
+
+/////////////////////////////////////////////////
+/// \brief Recursively compare two element description trees.
+void ExpectSameDescription(sdf::ElementConstPtr _a, sdf::ElementConstPtr _b)
+{
+  ASSERT_NE(nullptr, _a);
+  ASSERT_NE(nullptr, _b);
+  SCOPED_TRACE(_a->GetName());
+  EXPECT_EQ(_a->GetName(), _b->GetName());
+  EXPECT_EQ(_a->GetRequired(), _b->GetRequired());
+  EXPECT_EQ(_a->GetDescription(), _b->GetDescription());
+  EXPECT_EQ(_a->GetCopyChildren(), _b->GetCopyChildren());
+  EXPECT_EQ(_a->ReferenceSDF(), _b->ReferenceSDF());
+
+  ASSERT_EQ(_a->GetValue() == nullptr, _b->GetValue() == nullptr);
+  if (_a->GetValue())
+  {
+    EXPECT_EQ(_a->GetValue()->GetTypeName(), _b->GetValue()->GetTypeName());
+    EXPECT_EQ(_a->GetValue()->GetDefaultAsString(),
+              _b->GetValue()->GetDefaultAsString());
+    EXPECT_EQ(_a->GetValue()->GetRequired(), _b->GetValue()->GetRequired());
+  }
+
+  ASSERT_EQ(_a->GetAttributeCount(), _b->GetAttributeCount());
+  for (std::size_t i = 0; i < _a->GetAttributeCount(); ++i)
+  {
+    sdf::ParamPtr attrA = _a->GetAttribute(i);
+    sdf::ParamPtr attrB = _b->GetAttribute(i);
+    EXPECT_EQ(attrA->GetKey(), attrB->GetKey());
+    EXPECT_EQ(attrA->GetTypeName(), attrB->GetTypeName());
+    EXPECT_EQ(attrA->GetDefaultAsString(), attrB->GetDefaultAsString());
+    EXPECT_EQ(attrA->GetRequired(), attrB->GetRequired());
+    EXPECT_EQ(attrA->GetDescription(), attrB->GetDescription());
+  }
+
+  ASSERT_EQ(_a->GetElementDescriptionCount(),
+            _b->GetElementDescriptionCount());
+  for (std::size_t i = 0; i < _a->GetElementDescriptionCount(); ++i)
+  {
+    ExpectSameDescription(_a->GetElementDescription(i),
+                          _b->GetElementDescription(i));
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(Parser, EmbeddedDescriptionsMatchSpecXml)
+{
+  const std::string prefix = std::string(SDF_VERSION) + "/";
+  std::size_t count = 0;
+  for (const auto &[key, desc] : sdf::GetEmbeddedSdfDescriptions())
+  {
+    if (key.compare(0, prefix.size(), prefix) != 0)
+      continue;
+    SCOPED_TRACE(key);
+    ASSERT_NE(nullptr, desc);
+    ++count;
+
+    // Descriptions built from the precompiled tables
+    sdf::SDFPtr fromTables(new sdf::SDF());
+    EXPECT_TRUE(sdf::initFile(key.substr(prefix.size()), fromTables));
+
+    // Descriptions built by parsing the spec XML
+    sdf::SDFPtr fromXml(new sdf::SDF());
+    EXPECT_TRUE(sdf::initString(sdf::GetEmbeddedSdf().at(key), fromXml));
+
+    ExpectSameDescription(fromTables->Root(), fromXml->Root());
+  }
+  EXPECT_GT(count, 0u);
+}
+
 /////////////////////////////////////////////////
 TEST(Parser, readFileConversions)
 {
@@ -123,11 +123,11 @@ namespace sdf
 
   /// \brief Copy child XML elements into the _sdf element.
   /// \param[in] _sdf Parent Element.
-  /// \param[in] _xml Pointer to element from which child elements should be
-  /// copied.
+  /// \param[in] _xml Pointer to element or document from which child
+  /// elements should be copied.
   /// \param[in] _onlyUnknown True to copy only elements that are NOT part of
   /// the SDF spec. Set this to false to copy everything.
-  void copyChildren(ElementPtr _sdf, tinyxml2::XMLElement *_xml,
+  void copyChildren(ElementPtr _sdf, tinyxml2::XMLNode *_xml,
                     const bool _onlyUnknown);
   }
 }
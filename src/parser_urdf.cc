@@ -38,6 +38,7 @@
 #include "sdf/sdf.hh"
 #include "sdf/Types.hh"
 
+#include "FromChars.hh"
 #include "XmlUtils.hh"
 #include "SDFExtension.hh"
 #include "parser_urdf.hh"
@@ -54,17 +55,19 @@ typedef std::shared_ptr<SDFExtension> SDFExtensionPtr;
 typedef std::map<std::string, std::vector<SDFExtensionPtr> >
   StringSDFExtensionPtrMap;
 
+// The state of a conversion is kept per thread, so that URDF files can be
+// converted by several threads at once.
 /// create SDF geometry block based on URDF
-StringSDFExtensionPtrMap g_extensions;
-bool g_reduceFixedJoints;
-bool g_enforceLimits;
+thread_local StringSDFExtensionPtrMap g_extensions;
+thread_local bool g_reduceFixedJoints;
+thread_local bool g_enforceLimits;
 const char kCollisionExt[] = "_collision";
 const char kVisualExt[] = "_visual";
 const char kLumpPrefix[] = "_fixed_joint_lump__";
-urdf::Pose g_initialRobotPose;
-bool g_initialRobotPoseValid = false;
-std::set<std::string> g_fixedJointsTransformedInRevoluteJoints;
-std::set<std::string> g_fixedJointsTransformedInFixedJoints;
+thread_local urdf::Pose g_initialRobotPose;
+thread_local bool g_initialRobotPoseValid = false;
+thread_local std::set<std::string> g_fixedJointsTransformedInRevoluteJoints;
+thread_local std::set<std::string> g_fixedJointsTransformedInFixedJoints;
 const int g_outputDecimalPrecision = 16;
 const char kSdformatUrdfExtensionUrl[] =
     "http://sdformat.org/tutorials?tut=sdformat_urdf_extensions";
@@ -281,7 +284,8 @@ urdf::Vector3 ParseVector3(const std::string &_str, double _scale)
     {
       try
       {
-        vals.push_back(_scale * std::stod(pieces[i]));
+        vals.push_back(
+            _scale * sdf::stringToNumber<double>(trim(pieces[i])));
       }
       catch(std::invalid_argument &)
       {
@@ -1398,27 +1402,32 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       else if (strcmp(childElem->Name(), "dampingFactor") == 0)
       {
         sdf->isDampingFactor = true;
-        sdf->dampingFactor = std::stod(GetKeyValueAsString(childElem));
+        sdf->dampingFactor = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "maxVel") == 0)
       {
         sdf->isMaxVel = true;
-        sdf->maxVel = std::stod(GetKeyValueAsString(childElem));
+        sdf->maxVel = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "minDepth") == 0)
       {
         sdf->isMinDepth = true;
-        sdf->minDepth = std::stod(GetKeyValueAsString(childElem));
+        sdf->minDepth = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "mu1") == 0)
       {
         sdf->isMu1 = true;
-        sdf->mu1 = std::stod(GetKeyValueAsString(childElem));
+        sdf->mu1 = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "mu2") == 0)
       {
         sdf->isMu2 = true;
-        sdf->mu2 = std::stod(GetKeyValueAsString(childElem));
+        sdf->mu2 = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "fdir1") == 0)
       {
@@ -1427,12 +1436,14 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       else if (strcmp(childElem->Name(), "kp") == 0)
       {
         sdf->isKp = true;
-        sdf->kp = std::stod(GetKeyValueAsString(childElem));
+        sdf->kp = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "kd") == 0)
       {
         sdf->isKd = true;
-        sdf->kd = std::stod(GetKeyValueAsString(childElem));
+        sdf->kd = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "selfCollide") == 0)
       {
@@ -1453,37 +1464,44 @@ void URDF2SDF::ParseSDFExtension(tinyxml2::XMLDocument &_urdfXml)
       else if (strcmp(childElem->Name(), "maxContacts") == 0)
       {
         sdf->isMaxContacts = true;
-        sdf->maxContacts = std::stoi(GetKeyValueAsString(childElem));
+        sdf->maxContacts = sdf::stringToNumber<int>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "laserRetro") == 0)
       {
         sdf->isLaserRetro = true;
-        sdf->laserRetro = std::stod(GetKeyValueAsString(childElem));
+        sdf->laserRetro = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "springReference") == 0)
       {
         sdf->isSpringReference = true;
-        sdf->springReference = std::stod(GetKeyValueAsString(childElem));
+        sdf->springReference = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "springStiffness") == 0)
       {
         sdf->isSpringStiffness = true;
-        sdf->springStiffness = std::stod(GetKeyValueAsString(childElem));
+        sdf->springStiffness = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "stopCfm") == 0)
       {
         sdf->isStopCfm = true;
-        sdf->stopCfm = std::stod(GetKeyValueAsString(childElem));
+        sdf->stopCfm = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "stopErp") == 0)
       {
         sdf->isStopErp = true;
-        sdf->stopErp = std::stod(GetKeyValueAsString(childElem));
+        sdf->stopErp = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "fudgeFactor") == 0)
       {
         sdf->isFudgeFactor = true;
-        sdf->fudgeFactor = std::stod(GetKeyValueAsString(childElem));
+        sdf->fudgeFactor = sdf::stringToNumber<double>(
+            GetKeyValueAsString(childElem));
       }
       else if (strcmp(childElem->Name(), "provideFeedback") == 0)
       {
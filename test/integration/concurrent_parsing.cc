@@ -0,0 +1,178 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/Root.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+/// \brief Files loaded by the stress tests. They cover includes, URDF
+/// conversion and a world that uses most of the specification.
+static std::vector<std::string> testFiles()
+{
+  return {
+    sdf::testing::TestFile("sdf", "includes.sdf"),
+    sdf::testing::TestFile("sdf", "world_complete.sdf"),
+    sdf::testing::TestFile("integration", "fixed_joint_reduction.urdf"),
+  };
+}
+
+/////////////////////////////////////////////////
+/// \brief Create the parser configuration used by the stress tests.
+static sdf::ParserConfig testConfig()
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback([](const std::string &_uri)
+  {
+    return sdf::testing::TestFile("integration", "model", _uri);
+  });
+  return config;
+}
+
+/////////////////////////////////////////////////
+/// \brief Load a file with sdf::Root.
+/// \param[in] _file File to load.
+/// \param[in] _config Parser configuration.
+/// \param[out] _errors Errors of the load.
+/// \return The loaded element tree printed as a string.
+static std::string load(const std::string &_file,
+                        const sdf::ParserConfig &_config,
+                        sdf::Errors &_errors)
+{
+  sdf::Root root;
+  _errors = root.Load(_file, _config);
+  if (!root.Element())
+    return "";
+  return root.Element()->ToString("");
+}
+
+/////////////////////////////////////////////////
+/// Load the same files from many threads at once, sharing one parser
+/// configuration, and check that each load matches a load done by a single
+/// thread.
+TEST(ConcurrentParsing, RootLoad)
+{
+  const std::vector<std::string> files = testFiles();
+  const sdf::ParserConfig config = testConfig();
+
+  std::vector<std::string> expected;
+  std::vector<sdf::Errors> expectedErrors;
+  for (const auto &file : files)
+  {
+    sdf::Errors errors;
+    expected.push_back(load(file, config, errors));
+    EXPECT_FALSE(expected.back().empty()) << file;
+    expectedErrors.push_back(errors);
+  }
+
+  constexpr int kThreadCount = 8;
+  constexpr int kIterations = 4;
+  std::vector<std::vector<std::string>> results(kThreadCount);
+  std::vector<std::vector<std::size_t>> errorCounts(kThreadCount);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    threads.emplace_back([&, t]()
+    {
+      for (int i = 0; i < kIterations; ++i)
+      {
+        // Start each thread on a different file, so that different kinds of
+        // documents are parsed at the same time.
+        for (std::size_t f = 0; f < files.size(); ++f)
+        {
+          const std::size_t index = (f + t) % files.size();
+          sdf::Errors errors;
+          results[t].push_back(load(files[index], config, errors));
+          errorCounts[t].push_back(errors.size());
+        }
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    ASSERT_EQ(kIterations * files.size(), results[t].size());
+    for (std::size_t r = 0; r < results[t].size(); ++r)
+    {
+      const std::size_t index = (r % files.size() + t) % files.size();
+      EXPECT_EQ(expected[index], results[t][r])
+          << "thread " << t << ", file " << files[index];
+      EXPECT_EQ(expectedErrors[index].size(), errorCounts[t][r])
+          << "thread " << t << ", file " << files[index];
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// Read the same string from many threads at once, each thread with its
+/// own parser configuration.
+TEST(ConcurrentParsing, ReadString)
+{
+  const std::string sdfString = R"(
+  <sdf version="1.11">
+    <model name="model">
+      <pose>1 2 3 0 0 0</pose>
+      <link name="link">
+        <visual name="visual">
+          <geometry><box><size>1 1 1</size></box></geometry>
+        </visual>
+      </link>
+      <include>
+        <uri>test_model</uri>
+        <name>included</name>
+      </include>
+    </model>
+  </sdf>)";
+
+  constexpr int kThreadCount = 8;
+  std::vector<std::string> results(kThreadCount);
+  std::vector<sdf::Errors> errors(kThreadCount);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    threads.emplace_back([&, t]()
+    {
+      const sdf::ParserConfig config = testConfig();
+      sdf::SDFPtr sdf(new sdf::SDF());
+      sdf::init(sdf, config);
+      if (sdf::readString(sdfString, config, sdf, errors[t]))
+        results[t] = sdf->Root()->ToString("");
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    EXPECT_TRUE(errors[t].empty()) << errors[t];
+    EXPECT_FALSE(results[t].empty());
+    EXPECT_EQ(results[0], results[t]);
+  }
+}
@@ -15,6 +15,7 @@
  *
  */
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -22,41 +23,7 @@
 
 #include "sdf/sdf.hh"
 
-#include "test_config.hh"
-
-/////////////////////////////////////////////////
-std::string custom_exec(std::string _cmd)
-{
-#ifdef _WIN32
-  FILE *pipe = _popen(_cmd.c_str(), "r");
-#else
-  FILE *pipe = popen(_cmd.c_str(), "r");
-#endif
-
-  if (!pipe)
-  {
-    return "ERROR";
-  }
-
-  char buffer[128];
-  std::string result = "";
-
-  while (!feof(pipe))
-  {
-    if (fgets(buffer, 128, pipe) != nullptr)
-    {
-      result += buffer;
-    }
-  }
-
-#ifdef _WIN32
-  _pclose(pipe);
-#else
-  pclose(pipe);
-#endif
-
-  return result;
-}
+#include "memory_utils.hh"
 
 const std::string sdfString(
   "<?xml version='1.0'?>\n"
@@ -68,20 +35,11 @@ const std::string sdfString(
   "    </model>\n"
   "</sdf>");
 
-int getMemoryUsage()
-{
-  static const std::string getMemInfoPath =
-      sdf::testing::SourceFile("tools", "get_mem_info.py");
-  static const std::string pythonMeminfo("python3 " + getMemInfoPath);
-
-  return std::stoi(custom_exec(pythonMeminfo));
-}
-
 //////////////////////////////////////////////////
 TEST(ElementMemoryLeak, SDFCreateDestroy)
 {
   // Initial memory usage
-  int memoryLimit = getMemoryUsage();
+  int64_t memoryLimit = sdf::testing::MemoryUsage();
   std::cout << "initial memory: " << memoryLimit << std::endl;
 
   // Allow 15x increase (based on testing with Ubuntu and OSX)
@@ -92,11 +50,11 @@ TEST(ElementMemoryLeak, SDFCreateDestroy)
     sdf::SDF modelSDF;
     modelSDF.SetFromString(sdfString);
 
-    int memoryUsage = getMemoryUsage();
+    int64_t memoryUsage = sdf::testing::MemoryUsage();
     EXPECT_LT(memoryUsage, memoryLimit);
   }
 
   std::cout << "  final memory: "
-            << getMemoryUsage()
+            << sdf::testing::MemoryUsage()
             << std::endl;
 }
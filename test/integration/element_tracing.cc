@@ -28,6 +28,7 @@
 #include "sdf/World.hh"
 #include "sdf/Actor.hh"
 #include "sdf/Light.hh"
+#include "sdf/ParserConfig.hh"
 #include "test_config.hh"
 
 //////////////////////////////////////////////////
@@ -147,6 +148,50 @@ TEST(ElementTracing, NestedModels)
   EXPECT_EQ(nestedNestedLinkXmlPath, nestedNestedLinkElem->XmlPath());
 }
 
+//////////////////////////////////////////////////
+/// \brief Check that an element and its descendants have no line number and
+/// Xml path, but still know the file they were read from.
+void expectUntraced(const sdf::ElementPtr &_elem, const std::string &_file)
+{
+  ASSERT_NE(nullptr, _elem);
+  EXPECT_FALSE(_elem->LineNumber().has_value()) << _elem->GetName();
+  EXPECT_TRUE(_elem->XmlPath().empty()) << _elem->XmlPath();
+  if (!_file.empty())
+    EXPECT_EQ(_file, _elem->FilePath()) << _elem->GetName();
+
+  for (auto child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    expectUntraced(child, _file);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(ElementTracing, NestedModelsWithoutSourceTracing)
+{
+  const std::string testFile =
+    sdf::testing::TestFile("sdf", "nested_model.sdf");
+
+  sdf::ParserConfig config;
+  config.SetSourceTracing(false);
+
+  sdf::Root root;
+  auto errors = root.Load(testFile, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  // The document is loaded as usual
+  const sdf::Model *model = root.Model();
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ(2u, model->LinkCount());
+  EXPECT_EQ(1u, model->JointCount());
+  EXPECT_EQ(1u, model->ModelCount());
+  ASSERT_NE(nullptr, model->ModelByName("nested_model"));
+  EXPECT_NE(nullptr,
+      model->ModelByName("nested_model")->ModelByName("nested_nested_model"));
+
+  expectUntraced(root.Element(), testFile);
+}
+
 //////////////////////////////////////////////////
 TEST(ElementTracing, includes)
 {
@@ -297,3 +342,29 @@ TEST(ElementTracing, includes)
       overrideModelWithFileElem->XmlPath());
 }
 
+//////////////////////////////////////////////////
+TEST(ElementTracing, includesWithoutSourceTracing)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+  config.SetSourceTracing(false);
+
+  const auto worldFile = sdf::testing::TestFile("sdf", "includes.sdf");
+  sdf::Root root;
+  sdf::Errors errors = root.Load(worldFile, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  const sdf::World *world = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ(worldFile, world->Element()->FilePath());
+
+  const sdf::Actor *actor = world->ActorByIndex(0);
+  ASSERT_NE(nullptr, actor);
+  EXPECT_EQ(sdf::testing::TestFile(
+      "integration", "model", "test_actor", "model.sdf"),
+      actor->Element()->FilePath());
+
+  // Included elements are read from several files, so only check that none
+  // of them record a line number or Xml path.
+  expectUntraced(root.Element(), "");
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <gz/math/Pose3.hh>
+#include <atomic>
 #include <iostream>
 #include <string>
 
@@ -796,3 +797,201 @@ TEST(IncludesTest, InvalidMergeInclude)
   // Check nothing has been printed
   EXPECT_TRUE(buffer.str().empty()) << buffer.str();
 }
+
+//////////////////////////////////////////////////
+TEST(IncludesTest, IncludeCaching)
+{
+  const std::string sdfString = R"(
+    <sdf version="1.9">
+      <world name="default">
+        <include>
+          <uri>test_model</uri>
+        </include>
+        <include>
+          <uri>test_model</uri>
+          <name>second</name>
+          <pose relative_to="test_model">1 2 3 0 0 0</pose>
+          <static>true</static>
+        </include>
+        <include>
+          <uri>test_model</uri>
+          <name>third</name>
+          <plugin name="plugin" filename="test_plugin"/>
+          <experimental:params>
+            <link element_id="link" action="modify">
+              <pose>0 0 1 0 0 0</pose>
+            </link>
+          </experimental:params>
+        </include>
+      </world>
+    </sdf>)";
+
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+
+  // Each include applies its own overrides to a copy of the cached model,
+  // so the result is the same as without caching.
+  sdf::Root uncachedRoot;
+  sdf::Errors errors = uncachedRoot.LoadSdfString(sdfString, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  config.SetIncludeCaching(true);
+  for (int i = 0; i < 2; ++i)
+  {
+    sdf::Root cachedRoot;
+    errors = cachedRoot.LoadSdfString(sdfString, config);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_EQ(uncachedRoot.Element()->ToString(""),
+              cachedRoot.Element()->ToString(""));
+
+    const sdf::World *world = cachedRoot.WorldByIndex(0);
+    ASSERT_NE(nullptr, world);
+    ASSERT_EQ(3u, world->ModelCount());
+    EXPECT_FALSE(world->ModelByName("test_model")->Static());
+    EXPECT_TRUE(world->ModelByName("second")->Static());
+    EXPECT_EQ(gz::math::Pose3d(1, 2, 3, 0, 0, 0),
+              world->ModelByName("second")->RawPose());
+    EXPECT_EQ(0u, world->ModelByName("test_model")->Plugins().size());
+    EXPECT_EQ(1u, world->ModelByName("third")->Plugins().size());
+  }
+
+  const auto worldFile = sdf::testing::TestFile("sdf", "includes.sdf");
+  config.SetIncludeCaching(false);
+  sdf::Root uncachedWorld;
+  errors = uncachedWorld.Load(worldFile, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  config.SetIncludeCaching(true);
+  sdf::Root cachedWorld;
+  errors = cachedWorld.Load(worldFile, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(uncachedWorld.Element()->ToString(""),
+            cachedWorld.Element()->ToString(""));
+}
+
+//////////////////////////////////////////////////
+TEST(IncludesTest, IncludeThreadCount)
+{
+  const std::string sdfString = R"(
+    <sdf version="1.9">
+      <world name="default">
+        <include>
+          <uri>test_model</uri>
+        </include>
+        <include>
+          <uri>box_missing_config</uri>
+        </include>
+        <include>
+          <uri>test_model</uri>
+          <name>second</name>
+          <pose>1 2 3 0 0 0</pose>
+        </include>
+        <include>
+          <uri>test_model_with_frames</uri>
+        </include>
+        <include>
+          <uri>test_model</uri>
+          <name>third</name>
+          <static>true</static>
+        </include>
+      </world>
+    </sdf>)";
+
+  sdf::ParserConfig config;
+  config.SetFindCallback(findFileCb);
+
+  sdf::Root serialRoot;
+  const sdf::Errors serialErrors = serialRoot.LoadSdfString(sdfString, config);
+  EXPECT_FALSE(serialErrors.empty());
+
+  // The included files are read in parallel, but inserted in document order,
+  // so the document and the errors are the same as when read serially.
+  config.SetIncludeThreadCount(4);
+  for (bool caching : {false, true})
+  {
+    config.SetIncludeCaching(caching);
+    sdf::Root parallelRoot;
+    const sdf::Errors parallelErrors =
+        parallelRoot.LoadSdfString(sdfString, config);
+    ASSERT_EQ(serialErrors.size(), parallelErrors.size());
+    for (std::size_t i = 0; i < serialErrors.size(); ++i)
+    {
+      EXPECT_EQ(serialErrors[i].Code(), parallelErrors[i].Code());
+      EXPECT_EQ(serialErrors[i].Message(), parallelErrors[i].Message());
+    }
+    EXPECT_EQ(serialRoot.Element()->ToString(""),
+              parallelRoot.Element()->ToString(""));
+
+    const sdf::World *world = parallelRoot.WorldByIndex(0);
+    ASSERT_NE(nullptr, world);
+    ASSERT_EQ(4u, world->ModelCount());
+    EXPECT_EQ("test_model", world->ModelByIndex(0)->Name());
+    EXPECT_EQ("second", world->ModelByIndex(1)->Name());
+    EXPECT_EQ("third", world->ModelByIndex(3)->Name());
+  }
+
+  const auto worldFile = sdf::testing::TestFile("sdf", "includes.sdf");
+  config.SetIncludeCaching(false);
+  config.SetIncludeThreadCount(1);
+  sdf::Root serialWorld;
+  sdf::Errors errors = serialWorld.Load(worldFile, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  config.SetIncludeThreadCount(4);
+  sdf::Root parallelWorld;
+  errors = parallelWorld.Load(worldFile, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+  EXPECT_EQ(serialWorld.Element()->ToString(""),
+            parallelWorld.Element()->ToString(""));
+}
+
+//////////////////////////////////////////////////
+TEST(IncludesTest, IncludeThreadCountFailedInclude)
+{
+  // The first two includes are found without the find file callback, and
+  // the second one fails to be read, so the callback is not called for the
+  // following includes, as when reading serially.
+  const std::string sdfString = R"(
+    <sdf version="1.9">
+      <world name="default">
+        <include>
+          <uri>)" + sdf::testing::TestFile("integration", "model",
+              "test_model") + R"(</uri>
+        </include>
+        <include>
+          <uri>)" + sdf::testing::TestFile("sdf", "invalid_xml_syntax.sdf") +
+              R"(</uri>
+        </include>
+        <include>
+          <uri>test_model</uri>
+          <name>second</name>
+        </include>
+        <include>
+          <uri>test_model_with_frames</uri>
+        </include>
+      </world>
+    </sdf>)";
+
+  std::atomic<int> callbackCount{0};
+  sdf::ParserConfig config;
+  config.SetFindCallback([&callbackCount](const std::string &_uri)
+  {
+    ++callbackCount;
+    return findFileCb(_uri);
+  });
+
+  for (unsigned int threadCount : {1u, 4u})
+  {
+    config.SetIncludeThreadCount(threadCount);
+    sdf::Root root;
+    const sdf::Errors errors = root.LoadSdfString(sdfString, config);
+    bool readFailed = false;
+    for (const auto &error : errors)
+    {
+      if (error.Message().find("Unable to read file") != std::string::npos)
+        readFailed = true;
+    }
+    EXPECT_TRUE(readFailed) << errors;
+    EXPECT_EQ(0, callbackCount);
+  }
+}
@@ -54,12 +54,16 @@ TEST(CheckFixForLocal, MakeTestToFail)
   }
 
   setlocale(LC_NUMERIC, line);
+  const std::string numericLocale = setlocale(LC_NUMERIC, nullptr);
 
   // fix to allow make test without make install
   sdf::SDFPtr p(new sdf::SDF());
   sdf::init(p);
   ASSERT_TRUE(sdf::readFile(sdfTestFile, p));
 
+  // Parsing must not change the global locale of the application
+  EXPECT_EQ(numericLocale, setlocale(LC_NUMERIC, nullptr));
+
   sdf::ElementPtr elem = p->Root()->GetElement("world")
     ->GetElement("physics")->GetElement("ode")->GetElement("solver")
     ->GetElement("sor");
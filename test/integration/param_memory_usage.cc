@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+#include "memory_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Count the params of an element and its descendants.
+size_t paramCount(const sdf::ElementPtr &_elem)
+{
+  size_t count = _elem->GetAttributeCount() + (_elem->GetValue() ? 1 : 0);
+  for (auto child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    count += paramCount(child);
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+/// Report the memory used by the params of a large world. Params copied
+/// from the same description share their key, type, description, default
+/// and limits, so only the value record is allocated per param.
+TEST(ParamMemoryUsage, LargeWorld)
+{
+  std::cout << "sizeof(ParamPrivate): " << sizeof(sdf::ParamPrivate)
+            << " bytes\n"
+            << "sizeof(ParamPrivate::Descriptor): "
+            << sizeof(sdf::ParamPrivate::Descriptor) << " bytes (shared)"
+            << std::endl;
+
+  const std::string sdfString = sdf::testing::WorldString(2000, 4);
+
+  const int64_t initialMemory = sdf::testing::MemoryUsage();
+  size_t params = 0;
+  {
+    sdf::SDFPtr sdf(new sdf::SDF());
+    sdf::init(sdf);
+    sdf::Errors errors;
+    ASSERT_TRUE(sdf::readString(sdfString, sdf, errors));
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    params = paramCount(sdf->Root());
+    const int64_t loadedMemory = sdf::testing::MemoryUsage();
+    const double bytesPerParam =
+        static_cast<double>(loadedMemory - initialMemory) / params;
+
+    std::cout << "params: " << params << "\n"
+              << "memory increase: " << (loadedMemory - initialMemory)
+              << " bytes\n"
+              << "memory per param, including its element: "
+              << bytesPerParam << " bytes" << std::endl;
+
+    // Generous bound, to catch the per-param data growing back to include
+    // copies of the description.
+    EXPECT_LT(bytesPerParam, 2048.0);
+  }
+  EXPECT_GT(params, 0u);
+
+  std::cout << "memory after release: " << sdf::testing::MemoryUsage()
+            << " bytes" << std::endl;
+}
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <gz/math/Pose3.hh>
+
 #include "sdf/Filesystem.hh"
 #include "sdf/Model.hh"
 #include "sdf/ParserConfig.hh"
@@ -259,3 +261,56 @@ TEST(ParserConfig, NestedModelIncludesFilePath)
   sdf::Errors errors = root.Load(path, config);
   EXPECT_TRUE(errors.empty()) << errors;
 }
+
+/////////////////////////////////////////////////
+TEST(ParserConfig, LazyValueParsing)
+{
+  const auto path = sdf::testing::TestFile("sdf", "world_complete.sdf");
+
+  sdf::ParserConfig config;
+  sdf::Root eagerRoot;
+  sdf::Errors errors = eagerRoot.Load(path, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  config.SetLazyValueParsing(true);
+  sdf::Root lazyRoot;
+  errors = lazyRoot.Load(path, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  EXPECT_EQ(eagerRoot.Element()->ToString(""),
+            lazyRoot.Element()->ToString(""));
+}
+
+/////////////////////////////////////////////////
+TEST(ParserConfig, LazyValueParsingInvalidValue)
+{
+  const std::string sdfString = R"(
+  <sdf version="1.11">
+    <model name="model">
+      <pose>1 2</pose>
+      <link name="link"/>
+    </model>
+  </sdf>)";
+
+  sdf::ParserConfig config;
+  sdf::SDFPtr eagerSdf(new sdf::SDF());
+  sdf::init(eagerSdf);
+  sdf::Errors errors;
+  EXPECT_FALSE(sdf::readString(sdfString, config, eagerSdf, errors));
+  EXPECT_FALSE(errors.empty());
+
+  // The document is read, and the invalid pose is reported when it is read
+  config.SetLazyValueParsing(true);
+  sdf::SDFPtr lazySdf(new sdf::SDF());
+  sdf::init(lazySdf);
+  errors.clear();
+  EXPECT_TRUE(sdf::readString(sdfString, config, lazySdf, errors));
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  sdf::ElementPtr poseElem =
+      lazySdf->Root()->GetElement("model")->GetElement("pose");
+  EXPECT_EQ(gz::math::Pose3d::Zero,
+            poseElem->Get<gz::math::Pose3d>(errors, ""));
+  ASSERT_FALSE(errors.empty());
+  EXPECT_EQ(sdf::ErrorCode::PARAMETER_ERROR, errors[0].Code());
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/Link.hh"
+#include "sdf/Model.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/Root.hh"
+#include "sdf/World.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+/// Skip the elements only used for rendering, with both readers, and check
+/// that they are neither read nor loaded.
+TEST(SkippedElements, Rendering)
+{
+  const std::string sdfString = R"(
+  <sdf version="1.11">
+    <world name="default">
+      <gui fullscreen="true"/>
+      <scene><ambient>0.1 0.2 0.3 1</ambient></scene>
+      <plugin filename="physics" name="physics"><engine>dart</engine></plugin>
+      <model name="model">
+        <link name="link">
+          <visual name="visual">
+            <geometry><box><size>1 1 1</size></box></geometry>
+            <material><diffuse>1 0 0 1</diffuse></material>
+          </visual>
+          <collision name="collision">
+            <geometry><box><size>1 1 1</size></box></geometry>
+          </collision>
+        </link>
+      </model>
+    </world>
+  </sdf>)";
+
+  for (bool streaming : {false, true})
+  {
+    sdf::ParserConfig config;
+    config.SetStreamingParsing(streaming);
+    config.SetSkippedElements({"gui", "plugin", "scene", "visual"});
+
+    sdf::Root root;
+    sdf::Errors errors = root.LoadSdfString(sdfString, config);
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    const sdf::World *world = root.WorldByIndex(0);
+    ASSERT_NE(nullptr, world);
+    EXPECT_EQ(nullptr, world->Gui());
+    EXPECT_TRUE(world->Plugins().empty());
+
+    // The scene is required, but is not added with its default value.
+    sdf::ElementPtr worldElem = world->Element();
+    ASSERT_NE(nullptr, worldElem);
+    EXPECT_FALSE(worldElem->HasElement("gui"));
+    EXPECT_FALSE(worldElem->HasElement("plugin"));
+    EXPECT_FALSE(worldElem->HasElement("scene"));
+    EXPECT_TRUE(worldElem->HasElement("physics"));
+
+    const sdf::Model *model = world->ModelByIndex(0);
+    ASSERT_NE(nullptr, model);
+    const sdf::Link *link = model->LinkByIndex(0);
+    ASSERT_NE(nullptr, link);
+    EXPECT_EQ(0u, link->VisualCount());
+    EXPECT_EQ(1u, link->CollisionCount());
+    EXPECT_FALSE(link->Element()->HasElement("visual"));
+  }
+}
+
+/////////////////////////////////////////////////
+/// Skip the visuals of a world read from a file.
+TEST(SkippedElements, File)
+{
+  const std::string file =
+      sdf::testing::TestFile("sdf", "world_complete.sdf");
+
+  sdf::Root expected;
+  sdf::Errors errors = expected.Load(file);
+  ASSERT_TRUE(errors.empty()) << errors;
+  ASSERT_EQ(1u, expected.WorldByIndex(0)->ModelByIndex(0)->LinkByIndex(0)->
+      VisualCount());
+
+  sdf::ParserConfig config;
+  config.SetSkippedElements({"visual"});
+  sdf::Root root;
+  errors = root.Load(file, config);
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  ASSERT_EQ(expected.WorldCount(), root.WorldCount());
+  const sdf::World *expectedWorld = expected.WorldByIndex(0);
+  const sdf::World *world = root.WorldByIndex(0);
+  ASSERT_EQ(expectedWorld->ModelCount(), world->ModelCount());
+  for (uint64_t m = 0; m < world->ModelCount(); ++m)
+  {
+    const sdf::Model *expectedModel = expectedWorld->ModelByIndex(m);
+    const sdf::Model *model = world->ModelByIndex(m);
+    ASSERT_EQ(expectedModel->LinkCount(), model->LinkCount());
+    for (uint64_t l = 0; l < model->LinkCount(); ++l)
+    {
+      EXPECT_EQ(0u, model->LinkByIndex(l)->VisualCount());
+      EXPECT_EQ(expectedModel->LinkByIndex(l)->CollisionCount(),
+                model->LinkByIndex(l)->CollisionCount());
+    }
+  }
+}
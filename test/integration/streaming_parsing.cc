@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/Element.hh"
+#include "sdf/ParserConfig.hh"
+#include "sdf/SDFImpl.hh"
+#include "sdf/parser.hh"
+#include "test_config.hh"
+
+/////////////////////////////////////////////////
+/// \brief Create the parser configuration used by the tests.
+/// \param[in] _streaming True to use the streaming reader.
+static sdf::ParserConfig testConfig(bool _streaming)
+{
+  sdf::ParserConfig config;
+  config.SetFindCallback([](const std::string &_uri)
+  {
+    return sdf::testing::TestFile("integration", "model", _uri);
+  });
+  config.SetStreamingParsing(_streaming);
+  return config;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that two elements and their descendants have the same
+/// source information.
+/// \param[in] _expected Element read by the default reader.
+/// \param[in] _actual Element read by the streaming reader.
+static void expectSameSource(const sdf::ElementPtr &_expected,
+                             const sdf::ElementPtr &_actual)
+{
+  ASSERT_NE(nullptr, _actual);
+  EXPECT_EQ(_expected->GetName(), _actual->GetName());
+  EXPECT_EQ(_expected->LineNumber(), _actual->LineNumber())
+      << _expected->XmlPath();
+  EXPECT_EQ(_expected->XmlPath(), _actual->XmlPath());
+  EXPECT_EQ(_expected->FilePath(), _actual->FilePath());
+
+  auto expectedChild = _expected->GetFirstElement();
+  auto actualChild = _actual->GetFirstElement();
+  for (; expectedChild && actualChild;
+       expectedChild = expectedChild->GetNextElement(),
+       actualChild = actualChild->GetNextElement())
+  {
+    expectSameSource(expectedChild, actualChild);
+  }
+  EXPECT_EQ(nullptr, expectedChild);
+  EXPECT_EQ(nullptr, actualChild);
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that two lists of errors are the same.
+/// \param[in] _expected Errors of the default reader.
+/// \param[in] _actual Errors of the streaming reader.
+static void expectSameErrors(const sdf::Errors &_expected,
+                             const sdf::Errors &_actual)
+{
+  ASSERT_EQ(_expected.size(), _actual.size()) << _actual;
+  for (std::size_t i = 0; i < _expected.size(); ++i)
+  {
+    EXPECT_EQ(_expected[i].Code(), _actual[i].Code());
+    EXPECT_EQ(_expected[i].Message(), _actual[i].Message());
+    EXPECT_EQ(_expected[i].LineNumber(), _actual[i].LineNumber());
+    EXPECT_EQ(_expected[i].XmlPath(), _actual[i].XmlPath());
+  }
+}
+
+/////////////////////////////////////////////////
+/// Read every test file with both readers, and check that they build the
+/// same elements and report the same errors. The files are not converted,
+/// so that those of older versions are streamed too.
+TEST(StreamingParsing, TestFiles)
+{
+  const sdf::ParserConfig domConfig = testConfig(false);
+  const sdf::ParserConfig streamingConfig = testConfig(true);
+
+  std::vector<std::string> files;
+  for (const auto &entry :
+       std::filesystem::directory_iterator(sdf::testing::TestFile("sdf")))
+  {
+    if (entry.path().extension() == ".sdf")
+      files.push_back(entry.path().string());
+  }
+  ASSERT_FALSE(files.empty());
+
+  for (const auto &file : files)
+  {
+    SCOPED_TRACE(file);
+    sdf::SDFPtr expected(new sdf::SDF());
+    sdf::init(expected, domConfig);
+    sdf::Errors expectedErrors;
+    const bool expectedRead = sdf::readFileWithoutConversion(
+        file, domConfig, expected, expectedErrors);
+
+    sdf::SDFPtr actual(new sdf::SDF());
+    sdf::init(actual, streamingConfig);
+    sdf::Errors actualErrors;
+    const bool actualRead = sdf::readFileWithoutConversion(
+        file, streamingConfig, actual, actualErrors);
+
+    EXPECT_EQ(expectedRead, actualRead);
+
+    // XML errors are described by each reader
+    if (!expectedErrors.empty() &&
+        expectedErrors.back().Message().rfind("Error parsing XML", 0) == 0)
+    {
+      ASSERT_FALSE(actualErrors.empty());
+      EXPECT_EQ(sdf::ErrorCode::FILE_READ, actualErrors.back().Code());
+      continue;
+    }
+
+    expectSameErrors(expectedErrors, actualErrors);
+    EXPECT_EQ(expected->FilePath(), actual->FilePath());
+    EXPECT_EQ(expected->OriginalVersion(), actual->OriginalVersion());
+    EXPECT_EQ(expected->Root()->ToString(""), actual->Root()->ToString(""));
+    expectSameSource(expected->Root(), actual->Root());
+  }
+}
+
+/////////////////////////////////////////////////
+/// Read strings that cover values, copied and unknown elements, errors
+/// and documents that are not valid XML with both readers.
+TEST(StreamingParsing, Strings)
+{
+  const std::vector<std::string> strings = {
+    // Values, entities, comments, plugins and unknown elements
+    R"(<?xml version="1.0"?>
+    <!-- A model -->
+    <sdf version="1.11">
+      <model name="m&amp;m">
+        <pose>  1 2
+          3 0 0 0 </pose>
+        <static>true</static>
+        <link name="link">
+          <visual name="visual">
+            <geometry><box><size>1 1 1</size></box></geometry>
+          </visual>
+          <unknown_element attribute="value">text<child/></unknown_element>
+          <unknown_element><!-- no value -->text</unknown_element>
+          <custom:element>custom</custom:element>
+        </link>
+        <plugin name="plugin" filename="libplugin.so">
+          <param>1</param>
+          <nested a="b"><![CDATA[ raw <text> ]]></nested>
+        </plugin>
+      </model>
+    </sdf>)",
+    // Value that cannot be parsed
+    R"(<sdf version="1.11">
+      <model name="model">
+        <link name="link"><pose>1 2 three 0 0 0</pose></link>
+      </model>
+    </sdf>)",
+    // Missing required attribute
+    R"(<sdf version="1.11"><model><link name="link"/></model></sdf>)",
+    // Invalid top level pose
+    R"(<sdf version="1.11">
+      <model name="model"><pose relative_to="other"/></model>
+    </sdf>)",
+    // Prolog that is not valid XML, read by the default reader
+    R"(<?xml version="1.0"?><!-- not closed)",
+    // Older version, which is converted
+    R"(<sdf version="1.6"><model name="model"><link name="link"/></model>
+    </sdf>)",
+    // Includes, whose errors have the line numbers of the document
+    R"(<sdf version="1.11">
+    <world name="default">
+      <include><uri>missing_model</uri></include>
+      <include>
+        <uri>test_model</uri>
+        <name>renamed</name>
+        <pose relative_to="__model__">1 0 0 0 0 0</pose>
+      </include>
+      <include merge="false">
+        <uri>test_model</uri>
+        <placement_frame>__model__</placement_frame>
+      </include>
+    </world>
+    </sdf>)",
+  };
+
+  const sdf::ParserConfig domConfig = testConfig(false);
+  const sdf::ParserConfig streamingConfig = testConfig(true);
+  for (const auto &string : strings)
+  {
+    SCOPED_TRACE(string);
+    sdf::SDFPtr expected(new sdf::SDF());
+    sdf::init(expected, domConfig);
+    sdf::Errors expectedErrors;
+    const bool expectedRead =
+        sdf::readString(string, domConfig, expected, expectedErrors);
+
+    sdf::SDFPtr actual(new sdf::SDF());
+    sdf::init(actual, streamingConfig);
+    sdf::Errors actualErrors;
+    const bool actualRead =
+        sdf::readString(string, streamingConfig, actual, actualErrors);
+
+    EXPECT_EQ(expectedRead, actualRead);
+    expectSameErrors(expectedErrors, actualErrors);
+    EXPECT_EQ(expected->Root()->ToString(""), actual->Root()->ToString(""));
+    expectSameSource(expected->Root(), actual->Root());
+  }
+}
+
+/////////////////////////////////////////////////
+/// Read a document that is found not to be valid XML after some of it is
+/// read.
+TEST(StreamingParsing, InvalidXml)
+{
+  const std::string string = R"(<sdf version="1.11">
+    <model name="model">
+      <link name="link"/>
+    </sdf>)";
+
+  sdf::SDFPtr sdf(new sdf::SDF());
+  const sdf::ParserConfig config = testConfig(true);
+  sdf::init(sdf, config);
+  sdf::Errors errors;
+  EXPECT_FALSE(sdf::readString(string, config, sdf, errors));
+  ASSERT_EQ(1u, errors.size()) << errors;
+  EXPECT_EQ(sdf::ErrorCode::STRING_READ, errors[0].Code());
+  EXPECT_EQ(0u, errors[0].Message().rfind(
+      "Error parsing XML from string: Line 4: ", 0)) << errors[0].Message();
+}
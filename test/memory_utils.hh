@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SDF_TEST_MEMORY_UTILS_HH_
+#define SDF_TEST_MEMORY_UTILS_HH_
+
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "test_config.hh"
+
+namespace sdf
+{
+namespace testing
+{
+
+/// \brief Run a command and capture its standard output.
+/// \param[in] _cmd Command to run.
+/// \return The output of the command, "ERROR" if it could not be run.
+inline std::string Exec(const std::string &_cmd)
+{
+#ifdef _WIN32
+  FILE *pipe = _popen(_cmd.c_str(), "r");
+#else
+  FILE *pipe = popen(_cmd.c_str(), "r");
+#endif
+
+  if (!pipe)
+  {
+    return "ERROR";
+  }
+
+  char buffer[128];
+  std::string result = "";
+
+  while (!feof(pipe))
+  {
+    if (fgets(buffer, 128, pipe) != nullptr)
+    {
+      result += buffer;
+    }
+  }
+
+#ifdef _WIN32
+  _pclose(pipe);
+#else
+  pclose(pipe);
+#endif
+
+  return result;
+}
+
+/// \brief Get the resident memory of this process, as reported by
+/// tools/get_mem_info.py. Python and psutil are needed.
+/// \return Memory usage in bytes.
+inline int64_t MemoryUsage()
+{
+  static const std::string getMemInfoPath =
+      sdf::testing::SourceFile("tools", "get_mem_info.py");
+  static const std::string pythonMeminfo("python3 " + getMemInfoPath);
+
+  return std::stoll(Exec(pythonMeminfo));
+}
+
+/// \brief Create a world with many models, each with posed links, visuals
+/// and collisions.
+/// \param[in] _modelCount Number of models in the world.
+/// \param[in] _linkCount Number of links in each model.
+/// \return The SDFormat string of the world.
+inline std::string WorldString(int _modelCount, int _linkCount)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='1.11'>\n<world name='default'>\n";
+  for (int i = 0; i < _modelCount; ++i)
+  {
+    stream << "<model name='model" << i << "'>\n"
+           << "  <pose>" << i << " 0 0 0 0 0</pose>\n";
+    for (int j = 0; j < _linkCount; ++j)
+    {
+      stream << "  <link name='link" << j << "'>\n"
+             << "    <pose>0 0 " << j << " 0 0 0</pose>\n"
+             << "    <visual name='visual'><pose>0 0 0 0 0 0</pose>\n"
+             << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+             << "    </visual>\n"
+             << "    <collision name='collision'><pose>0 0 0 0 0 0</pose>\n"
+             << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+             << "    </collision>\n"
+             << "  </link>\n";
+    }
+    stream << "</model>\n";
+  }
+  stream << "</world>\n</sdf>\n";
+  return stream.str();
+}
+
+} // namespace testing
+} // namespace sdf
+
+#endif
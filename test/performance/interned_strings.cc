@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+#include "memory_utils.hh"
+
+/////////////////////////////////////////////////
+/// \brief Count an element and its descendants.
+std::size_t elementCount(const sdf::ElementPtr &_elem)
+{
+  std::size_t count = 1;
+  for (auto child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    count += elementCount(child);
+  }
+  return count;
+}
+
+/////////////////////////////////////////////////
+/// \brief Copy the interned metadata strings of an element, its params and
+/// its descendants, as they were stored before they were interned.
+/// \param[in] _elem Element to copy the strings of.
+/// \param[out] _copies Copies of the strings.
+void copyMetadata(const sdf::ElementPtr &_elem,
+                  std::vector<std::string> &_copies)
+{
+  _copies.push_back(_elem->GetName());
+  _copies.push_back(_elem->GetRequired());
+  _copies.push_back(_elem->GetDescription());
+  _copies.push_back(_elem->ReferenceSDF());
+  _copies.push_back(_elem->FilePath());
+  _copies.push_back(_elem->OriginalVersion());
+
+  auto params = _elem->GetAttributes();
+  if (_elem->GetValue())
+    params.push_back(_elem->GetValue());
+  for (const auto &param : params)
+  {
+    _copies.push_back(param->GetKey());
+    _copies.push_back(param->GetTypeName());
+    _copies.push_back(param->GetDescription());
+    _copies.push_back(param->GetDefaultAsString());
+  }
+
+  for (auto child = _elem->GetFirstElement(); child;
+       child = child->GetNextElement())
+  {
+    copyMetadata(child, _copies);
+  }
+}
+
+//////////////////////////////////////////////////
+/// Compare the memory used by the metadata of a large world with and
+/// without interning. The names, descriptions and types of its elements and
+/// params are interned, so the pool only grows by their distinct values,
+/// which are released with the document. The baseline stores a copy of each
+/// string, as every element and param did before.
+TEST(InternedStrings, World10kModels)
+{
+  const int modelCount = 10000;
+  const std::string sdfString = sdf::testing::WorldString(modelCount, 1);
+
+  std::size_t specPoolSize = 0;
+  {
+    sdf::SDFPtr sdfParsed(new sdf::SDF());
+    sdf::init(sdfParsed);
+    specPoolSize = sdf::InternedString::PoolSize();
+    sdf::Errors errors;
+    ASSERT_TRUE(sdf::readString(sdfString, sdfParsed, errors));
+    EXPECT_TRUE(errors.empty()) << errors;
+
+    const std::size_t elements = elementCount(sdfParsed->Root());
+    const int64_t pooled =
+        static_cast<int64_t>(sdf::InternedString::PoolSize()) -
+        static_cast<int64_t>(specPoolSize);
+
+    // Count the strings first, so that the vector is not reallocated while
+    // the copies are measured.
+    std::vector<std::string> copies;
+    copyMetadata(sdfParsed->Root(), copies);
+    const std::size_t stringCount = copies.size();
+    copies.clear();
+    copies.shrink_to_fit();
+    copies.reserve(stringCount);
+
+    const int64_t beforeCopies = sdf::testing::MemoryUsage();
+    copyMetadata(sdfParsed->Root(), copies);
+    const int64_t copiedMemory = sdf::testing::MemoryUsage() - beforeCopies;
+
+    // With interning, each string is a handle in its element or param, and
+    // the world only adds its few distinct values to the pool.
+    const int64_t internedMemory = static_cast<int64_t>(
+        stringCount * sizeof(sdf::InternedString));
+    const int64_t notInternedMemory = static_cast<int64_t>(
+        stringCount * sizeof(std::string)) + copiedMemory;
+
+    std::cout << "models: " << modelCount << "\n"
+              << "elements: " << elements << "\n"
+              << "metadata strings: " << stringCount << "\n"
+              << "pooled strings of the spec: " << specPoolSize << "\n"
+              << "pooled strings added by the world: " << pooled << "\n"
+              << "metadata memory without interning: " << notInternedMemory
+              << " bytes\n"
+              << "metadata memory with interning: " << internedMemory
+              << " bytes\n"
+              << "saved by interning: "
+              << (notInternedMemory - internedMemory) << " bytes, "
+              << static_cast<double>(notInternedMemory - internedMemory) /
+                 elements << " bytes per element" << std::endl;
+
+    // The metadata of the world's elements comes from the spec, so the
+    // world adds few distinct values to the pool, however many models it has.
+    EXPECT_LT(pooled, 1000);
+    EXPECT_LT(internedMemory, notInternedMemory);
+  }
+
+  // Strings are released with the last element that uses them.
+  EXPECT_LE(sdf::InternedString::PoolSize(), specPoolSize);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "sdf/sdf.hh"
+
+/////////////////////////////////////////////////
+/// \brief Get the time in nanoseconds per call of a function.
+/// \param[in] _iterations Number of calls.
+/// \param[in] _func Function to time.
+/// \return Nanoseconds per call.
+template <typename Func>
+double nsPerCall(int _iterations, Func _func)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < _iterations; ++i)
+    _func();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+  return static_cast<double>(elapsed.count()) / _iterations;
+}
+
+/////////////////////////////////////////////////
+/// \brief Create a world with many links, each with posed children.
+std::string poseHeavyWorld(int _modelCount)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='1.11'>\n<world name='default'>\n";
+  for (int i = 0; i < _modelCount; ++i)
+  {
+    stream << "<model name='model_" << i << "'>\n"
+           << "  <pose>" << i << " 0.25 0.5 0 0 1.5707</pose>\n"
+           << "  <link name='link'>\n"
+           << "    <pose>0 0 0.1 0.01 0.02 0.03</pose>\n"
+           << "    <inertial>\n"
+           << "      <pose>0.001 0.002 0.003 0 0 0</pose>\n"
+           << "      <mass>1.5</mass>\n"
+           << "    </inertial>\n"
+           << "    <collision name='collision'>\n"
+           << "      <pose degrees='true'>0 0 0 90 0 45</pose>\n"
+           << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+           << "    </collision>\n"
+           << "    <visual name='visual'>\n"
+           << "      <pose rotation_format='quat_xyzw'>"
+           << "0 0 0 0 0 0.7071 0.7071</pose>\n"
+           << "      <geometry><box><size>1 1 1</size></box></geometry>\n"
+           << "    </visual>\n"
+           << "  </link>\n"
+           << "</model>\n";
+  }
+  stream << "</world>\n</sdf>\n";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+TEST(ParamParsing, ValueFromString)
+{
+  const int iterations = 200000;
+  sdf::Errors errors;
+
+  sdf::Param poseParam("pose", "pose", "0 0 0 0 0 0", false);
+  sdf::Param doubleParam("mass", "double", "0", false);
+  sdf::Param vectorParam("size", "vector3", "1 1 1", false);
+  sdf::Param boolParam("static", "bool", "false", false);
+
+  const double poseNs = nsPerCall(iterations, [&]()
+      {
+        poseParam.SetFromString(" 1.5 -2 3e-1 0.1 0.2 0.3 ", errors);
+      });
+  const double doubleNs = nsPerCall(iterations, [&]()
+      {
+        doubleParam.SetFromString("12.75", errors);
+      });
+  const double vectorNs = nsPerCall(iterations, [&]()
+      {
+        vectorParam.SetFromString("1 2 3", errors);
+      });
+  const double boolNs = nsPerCall(iterations, [&]()
+      {
+        boolParam.SetFromString("True", errors);
+      });
+  EXPECT_TRUE(errors.empty()) << errors;
+
+  std::cout << "Param::SetFromString, ns per call\n"
+            << "  pose:    " << poseNs << "\n"
+            << "  double:  " << doubleNs << "\n"
+            << "  vector3: " << vectorNs << "\n"
+            << "  bool:    " << boolNs << "\n";
+}
+
+/////////////////////////////////////////////////
+TEST(ParamParsing, PoseHeavyWorld)
+{
+  const int modelCount = 2000;
+  const int runs = 5;
+  const std::string sdfString = poseHeavyWorld(modelCount);
+
+  double totalMs = 0;
+  for (int i = 0; i < runs; ++i)
+  {
+    sdf::Root root;
+    auto start = std::chrono::steady_clock::now();
+    sdf::Errors errors = root.LoadSdfString(sdfString);
+    totalMs += std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    EXPECT_TRUE(errors.empty()) << errors;
+    ASSERT_NE(nullptr, root.WorldByIndex(0));
+    EXPECT_EQ(static_cast<uint64_t>(modelCount),
+              root.WorldByIndex(0)->ModelCount());
+  }
+
+  std::cout << "Pose heavy world with " << modelCount << " models, "
+            << "mean load time: " << totalMs / runs << " ms\n";
+}